@@ -0,0 +1,302 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <tuplet/layout.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+// Measures the cost of passing and returning small tuples across calls that
+// can't be inlined, either because the callee is marked noinline or because
+// it's called through a function pointer. Each benchmark reports calls per
+// second as items/s.
+//
+// On the System V x86-64 ABI, a value is passed in registers only if it's
+// at most 16 bytes and trivial for the purposes of calls; each eightbyte then
+// goes in a general purpose register (INTEGER) or a vector register (SSE).
+// The classification of every tuplet shape benchmarked here is checked at
+// compile time below, so a change in layout that forces a tuple into memory
+// is caught when building the benchmarks.
+
+#if defined(__GNUC__) && !defined(__clang__)
+// noinline alone still allows GCC to propagate constants into the callee, or
+// to elide a call to a function it can see has no side effects
+#define BENCH_NOINLINE [[gnu::noipa]]
+#elif defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE [[gnu::noinline]]
+#endif
+
+namespace {
+    template <class S, size_t>
+    using _always = S;
+
+    template <template <class...> class Tup, class S, class Seq>
+    struct _repeat;
+    template <template <class...> class Tup, class S, size_t... I>
+    struct _repeat<Tup, S, std::index_sequence<I...>> {
+        using type = Tup<_always<S, I>...>;
+    };
+
+    /// Tup<S, S, ...> with N elements
+    template <template <class...> class Tup, class S, size_t N>
+    using repeat_t = typename _repeat<Tup, S, std::make_index_sequence<N>>::type;
+
+    /// Plain struct with the same layout as a tuple of N scalars. An array
+    /// member is classified the same way as N separate members
+    template <class S, size_t N>
+    struct scalars {
+        S values[N];
+    };
+
+    struct int32_float {
+        int32_t a;
+        float b;
+    };
+    struct int64_double {
+        int64_t a;
+        double b;
+    };
+} // namespace
+
+
+
+
+
+//////////////////////////////////////////
+////  System V x86-64 classification  ////
+//////////////////////////////////////////
+
+namespace {
+    enum class sysv_class { none, integer, sse, memory };
+
+    /// Classification of a value, one entry per eightbyte. Values that don't
+    /// fit in two eightbytes are passed in memory
+    struct sysv_classes {
+        sysv_class lo = sysv_class::none;
+        sysv_class hi = sysv_class::none;
+
+        constexpr bool operator==(sysv_classes const& other) const {
+            return lo == other.lo && hi == other.hi;
+        }
+        constexpr bool in_registers() const {
+            return lo != sysv_class::memory;
+        }
+    };
+
+    constexpr sysv_classes in_memory {sysv_class::memory, sysv_class::memory};
+
+    template <class T>
+    constexpr bool trivial_for_calls =
+        std::is_trivially_copy_constructible_v<T>
+        && std::is_trivially_move_constructible_v<T>
+        && std::is_trivially_destructible_v<T>;
+
+    template <class S>
+    constexpr sysv_class scalar_class() {
+        static_assert(std::is_scalar_v<S>, "Only tuples of scalars are classified");
+        if constexpr (std::is_same_v<S, long double>) {
+            return sysv_class::memory; // X87 class, never in SSE registers
+        } else if constexpr (std::is_floating_point_v<S>) {
+            return sysv_class::sse;
+        } else {
+            return sysv_class::integer;
+        }
+    }
+
+    /// Merges the class of a scalar into the class of its eightbyte. INTEGER
+    /// wins over SSE, and MEMORY wins over everything
+    constexpr sysv_class merge(sysv_class a, sysv_class b) {
+        if (a == sysv_class::none) return b;
+        if (b == sysv_class::none) return a;
+        if (a == sysv_class::memory || b == sysv_class::memory) {
+            return sysv_class::memory;
+        }
+        if (a == sysv_class::integer || b == sysv_class::integer) {
+            return sysv_class::integer;
+        }
+        return sysv_class::sse;
+    }
+
+    /// Classifies a tuplet::tuple of scalars, using tuplet::layout to find
+    /// which eightbyte each element lives in
+    template <class Tup, class... S, size_t... I>
+    constexpr sysv_classes _classify(std::index_sequence<I...>) {
+        using L = tuplet::layout<Tup>;
+        if (L::size > 16 || !trivial_for_calls<Tup>) {
+            return in_memory;
+        }
+        sysv_class classes[2] {};
+        ((classes[L::template offset_of<I> / 8] = merge(
+              classes[L::template offset_of<I> / 8],
+              scalar_class<S>())),
+         ...);
+        if (classes[0] == sysv_class::memory
+            || classes[1] == sysv_class::memory) {
+            return in_memory;
+        }
+        return {classes[0], classes[1]};
+    }
+
+    template <class Tup>
+    struct _classify_tuple;
+    template <class... S>
+    struct _classify_tuple<tuplet::tuple<S...>> {
+        constexpr static sysv_classes value = _classify<tuplet::tuple<S...>, S...>(
+            std::index_sequence_for<S...>());
+    };
+    template <class A, class B>
+    struct _classify_tuple<tuplet::pair<A, B>> {
+        // A pair lays out its members the same way as a tuple
+        constexpr static sysv_classes value = _classify_tuple<
+            tuplet::tuple<A, B>>::value;
+    };
+
+    template <class Tup>
+    constexpr sysv_classes classify = _classify_tuple<Tup>::value;
+
+    /// True if T is passed the same way as a tuple with the same layout
+    template <class T, class Tup>
+    constexpr bool same_abi = sizeof(T) == sizeof(Tup)
+                           && alignof(T) == alignof(Tup)
+                           && trivial_for_calls<T> == trivial_for_calls<Tup>;
+
+    constexpr auto INT = sysv_class::integer;
+    constexpr auto SSE = sysv_class::sse;
+    constexpr auto NONE = sysv_class::none;
+
+    template <class S, size_t N>
+    using tuplet_n = repeat_t<tuplet::tuple, S, N>;
+    template <class S, size_t N>
+    using std_n = repeat_t<std::tuple, S, N>;
+
+#if defined(__x86_64__) && !defined(_WIN32)
+    static_assert(classify<tuplet_n<int64_t, 1>> == sysv_classes {INT, NONE});
+    static_assert(classify<tuplet_n<int64_t, 2>> == sysv_classes {INT, INT});
+    static_assert(!classify<tuplet_n<int64_t, 3>>.in_registers());
+    static_assert(classify<tuplet_n<double, 1>> == sysv_classes {SSE, NONE});
+    static_assert(classify<tuplet_n<double, 2>> == sysv_classes {SSE, SSE});
+    static_assert(!classify<tuplet_n<double, 3>>.in_registers());
+    // Small elements are packed into the same eightbyte
+    static_assert(classify<tuplet_n<int32_t, 4>> == sysv_classes {INT, INT});
+    static_assert(!classify<tuplet_n<int32_t, 5>>.in_registers());
+    static_assert(classify<tuplet_n<float, 4>> == sysv_classes {SSE, SSE});
+    static_assert(classify<tuplet_n<int8_t, 8>> == sysv_classes {INT, NONE});
+    // An eightbyte holding both an integer and a float goes in a general
+    // purpose register
+    static_assert(
+        classify<tuplet::pair<int32_t, float>> == sysv_classes {INT, NONE});
+    static_assert(
+        classify<tuplet::pair<int64_t, double>> == sysv_classes {INT, SSE});
+    static_assert(!classify<tuplet::pair<int64_t, long double>>.in_registers());
+    // Elements are never reordered, so padding can push a tuple into memory
+    static_assert(!classify<tuplet::tuple<char, double, char>>.in_registers());
+    static_assert(classify<tuplet::tuple<double, char, char>>.in_registers());
+#endif
+
+    template <size_t... N>
+    constexpr bool check_same_abi(std::index_sequence<N...>) {
+        return ((same_abi<scalars<int64_t, N + 1>, tuplet_n<int64_t, N + 1>>
+                 && same_abi<scalars<double, N + 1>, tuplet_n<double, N + 1>>)
+                && ...);
+    }
+
+    // Plain structs of the same scalars are passed the same way as
+    // tuplet::tuple, so the classifications above apply to them as well
+    static_assert(check_same_abi(std::make_index_sequence<8>()));
+    static_assert(same_abi<int32_float, tuplet::pair<int32_t, float>>);
+    static_assert(same_abi<int64_double, tuplet::pair<int64_t, double>>);
+
+#if defined(__GLIBCXX__)
+    // libstdc++ gives std::tuple a user-provided move constructor, which
+    // makes it non-trivial for the purposes of calls: even a std::tuple of
+    // a single int64_t is passed and returned through memory
+    template <size_t... N>
+    constexpr bool check_std_tuple_in_memory(std::index_sequence<N...>) {
+        return ((!trivial_for_calls<std_n<int64_t, N + 1>>
+                 && !trivial_for_calls<std_n<double, N + 1>>)
+                && ...);
+    }
+    static_assert(check_std_tuple_in_memory(std::make_index_sequence<8>()));
+#endif
+} // namespace
+
+
+
+
+
+///////////////////////////////////
+////  Calls across boundaries  ////
+///////////////////////////////////
+
+template <class T>
+BENCH_NOINLINE T pass_through(T value) {
+    return value;
+}
+
+template <class T>
+void BM_call_noinline(benchmark::State& state) {
+    T value {};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        value = pass_through<T>(value);
+    }
+    benchmark::DoNotOptimize(value);
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <class T>
+void BM_call_function_pointer(benchmark::State& state) {
+    // volatile, so that the call can't be resolved at compile time
+    T (*volatile fn)(T) = &pass_through<T>;
+    T value {};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        value = fn(value);
+    }
+    benchmark::DoNotOptimize(value);
+    state.SetItemsProcessed(state.iterations());
+}
+
+namespace {
+    template <class T>
+    void register_calls(std::string const& name) {
+        benchmark::RegisterBenchmark(
+            ("BM_call_noinline/" + name).c_str(),
+            BM_call_noinline<T>);
+        benchmark::RegisterBenchmark(
+            ("BM_call_function_pointer/" + name).c_str(),
+            BM_call_function_pointer<T>);
+    }
+
+    template <class S, size_t... N>
+    void register_shapes(char const* scalar, std::index_sequence<N...>) {
+        auto suffix = [&](size_t n) {
+            return "<" + std::string(scalar) + " x " + std::to_string(n) + ">";
+        };
+        ((register_calls<tuplet_n<S, N + 1>>("tuplet::tuple" + suffix(N + 1)),
+          register_calls<std_n<S, N + 1>>("std::tuple" + suffix(N + 1)),
+          register_calls<scalars<S, N + 1>>("struct" + suffix(N + 1))),
+         ...);
+    }
+
+    int register_all() {
+        register_shapes<int64_t>("int64_t", std::make_index_sequence<8>());
+        register_shapes<double>("double", std::make_index_sequence<8>());
+
+        register_calls<tuplet::pair<int32_t, float>>(
+            "tuplet::pair<int32_t, float>");
+        register_calls<std::pair<int32_t, float>>("std::pair<int32_t, float>");
+        register_calls<int32_float>("struct<int32_t, float>");
+        register_calls<tuplet::pair<int64_t, double>>(
+            "tuplet::pair<int64_t, double>");
+        register_calls<std::pair<int64_t, double>>(
+            "std::pair<int64_t, double>");
+        register_calls<int64_double>("struct<int64_t, double>");
+        return 0;
+    }
+
+    int registered = register_all();
+} // namespace
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+// Counts the tuples of 8 floats in which any element is below a threshold,
+// with tuple::any (short-circuiting, so a branch per element) and
+// tuple::any_eager (every element, combined with |).
+//
+// - random: each element is below the threshold with probability
+//   state.range(0) / 100, so where any() stops is unpredictable. any_eager
+//   wins once that's more than a few percent; at 1%, any() almost always
+//   checks every element anyway, and its branches are predictable
+// - first: the first element is always below the threshold, so any() stops
+//   after one predictable comparison
+// - expensive: like random, but the predicate calls exp and sin, so
+//   skipping work matters more than avoiding branches
+//
+// There are 65536 rows, so that the branch predictor can't learn the
+// outcomes from one pass over the rows to the next.
+
+namespace {
+    using row_t = tuplet::
+        tuple<float, float, float, float, float, float, float, float>;
+
+    constexpr float threshold = 0.5f;
+
+    std::vector<row_t> make_rows(double probability, bool first_matches) {
+        std::mt19937 rng(42);
+        std::bernoulli_distribution below(probability);
+        std::uniform_real_distribution<float> low(0.0f, threshold);
+        std::uniform_real_distribution<float> high(threshold, 1.0f);
+        std::vector<row_t> rows(1 << 16);
+        for (auto& row : rows) {
+            row.for_each([&](float& x) {
+                x = below(rng) ? low(rng) : high(rng);
+            });
+            if (first_matches) {
+                tuplet::get<0>(row) = low(rng);
+            }
+        }
+        return rows;
+    }
+
+    struct cheap {
+        bool operator()(float x) const { return x < threshold; }
+    };
+    struct expensive {
+        bool operator()(float x) const {
+            return std::exp(std::sin(x)) < std::exp(std::sin(threshold));
+        }
+    };
+
+    struct short_circuit {
+        template <class F>
+        bool operator()(row_t const& row, F f) const {
+            return row.any(f);
+        }
+    };
+    struct eager {
+        template <class F>
+        bool operator()(row_t const& row, F f) const {
+            return row.any_eager(f);
+        }
+    };
+} // namespace
+
+template <class Mode, class Pred>
+static void BM_any_random(benchmark::State& state) {
+    auto rows = make_rows(double(state.range(0)) / 100.0, false);
+    for (auto _ : state) {
+        int64_t count = 0;
+        for (auto const& row : rows) {
+            count += Mode()(row, Pred());
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows.size()));
+}
+
+template <class Mode>
+static void BM_any_first(benchmark::State& state) {
+    auto rows = make_rows(0.05, true);
+    for (auto _ : state) {
+        int64_t count = 0;
+        for (auto const& row : rows) {
+            count += Mode()(row, cheap());
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_any_random, short_circuit, cheap)
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(30);
+BENCHMARK_TEMPLATE(BM_any_random, eager, cheap)->Arg(1)->Arg(10)->Arg(30);
+BENCHMARK_TEMPLATE(BM_any_first, short_circuit);
+BENCHMARK_TEMPLATE(BM_any_first, eager);
+BENCHMARK_TEMPLATE(BM_any_random, short_circuit, expensive)->Arg(30);
+BENCHMARK_TEMPLATE(BM_any_random, eager, expensive)->Arg(30);
@@ -0,0 +1,82 @@
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mutex>
+#include <tuplet/atomic.hpp>
+#include <tuplet/tuple.hpp>
+
+// Several threads update the same 16-byte state: a counter, a generation,
+// and a running total. Each iteration bumps the counter, then reads the
+// whole state. The state is shared by an atomic_tuple, a tuple guarded by a
+// std::mutex, and a std::atomic of a plain struct (which GCC implements in
+// libatomic).
+//
+// atomic_tuple is only lock-free for 16-byte tuples when the compiler can
+// emit a double-width compare-and-swap (-mcx16 on x86-64); is_lock_free is
+// reported as a counter.
+
+namespace {
+    using state_t = tuplet::tuple<uint32_t, uint32_t, uint64_t>;
+
+    struct state_struct {
+        uint32_t count;
+        uint32_t generation;
+        uint64_t total;
+    };
+
+    tuplet::atomic_tuple<uint32_t, uint32_t, uint64_t> shared_atomic_tuple;
+
+    struct {
+        std::mutex mutex;
+        state_t value {};
+    } shared_locked;
+
+    std::atomic<state_struct> shared_atomic_struct {state_struct {}};
+} // namespace
+
+static void BM_atomic_tuple(benchmark::State& state) {
+    for (auto _ : state) {
+        shared_atomic_tuple.fetch_add<0>(1);
+        benchmark::DoNotOptimize(shared_atomic_tuple.load());
+    }
+    state.counters["lock_free"] = benchmark::Counter(
+        decltype(shared_atomic_tuple)::is_always_lock_free,
+        benchmark::Counter::kAvgThreads);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_mutex(benchmark::State& state) {
+    for (auto _ : state) {
+        {
+            std::lock_guard<std::mutex> lock(shared_locked.mutex);
+            tuplet::get<0>(shared_locked.value)++;
+        }
+        state_t copy;
+        {
+            std::lock_guard<std::mutex> lock(shared_locked.mutex);
+            copy = shared_locked.value;
+        }
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_std_atomic_struct(benchmark::State& state) {
+    for (auto _ : state) {
+        state_struct current = shared_atomic_struct.load();
+        state_struct next;
+        do {
+            next = current;
+            next.count++;
+        } while (!shared_atomic_struct.compare_exchange_weak(current, next));
+        benchmark::DoNotOptimize(shared_atomic_struct.load());
+    }
+    state.counters["lock_free"] = benchmark::Counter(
+        shared_atomic_struct.is_lock_free(),
+        benchmark::Counter::kAvgThreads);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_atomic_tuple)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_mutex)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_std_atomic_struct)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,66 @@
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <tuplet/cacheline.hpp>
+#include <tuplet/tuple.hpp>
+#include <utility>
+
+// Each thread increments its own counter in a set of eight counters. With
+// a dense tuple, the counters share a cache line, which bounces between the
+// cores running the threads; with a cacheline_tuple, every counter has a
+// line to itself.
+
+namespace {
+    using counter = std::atomic<uint64_t>;
+
+    tuplet::tuple<
+        counter,
+        counter,
+        counter,
+        counter,
+        counter,
+        counter,
+        counter,
+        counter>
+        dense;
+
+    tuplet::cacheline_tuple<
+        counter,
+        counter,
+        counter,
+        counter,
+        counter,
+        counter,
+        counter,
+        counter>
+        padded;
+
+    template <class Tuple, size_t... I>
+    counter& counter_at(Tuple& tup, size_t i, std::index_sequence<I...>) {
+        counter* counters[] {&tuplet::get<I>(tup)...};
+        return *counters[i % sizeof...(I)];
+    }
+
+    template <class Tuple>
+    void increment_own_counter(benchmark::State& state, Tuple& tup) {
+        counter& own = counter_at(
+            tup,
+            size_t(state.thread_index()),
+            std::make_index_sequence<8>());
+        for (auto _ : state) {
+            own.fetch_add(1, std::memory_order_relaxed);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+static void BM_dense_counters(benchmark::State& state) {
+    increment_own_counter(state, dense);
+}
+
+static void BM_cacheline_counters(benchmark::State& state) {
+    increment_own_counter(state, padded);
+}
+
+BENCHMARK(BM_dense_counters)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_cacheline_counters)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <tuplet/elementwise.hpp>
+#include <tuplet/tuple.hpp>
+#include <utility>
+#include <vector>
+
+// Computes out[k] = clamp((a[k] - b[k]) * s + c[k], lo, hi) over arrays of
+// tuples, using the first 3, 4, or 5 operations of that chain. Each step is
+// either a map over a materialized tuple (as with tuple::map), or part of a
+// single elementwise expression. The bounds are only known at run time, as
+// they usually are, and both forms break ties the same way (the way
+// elementwise::min and max do), so both compile to the same minps/maxps.
+
+namespace {
+    using float4 = tuplet::tuple<float, float, float, float>;
+    using int8x = tuplet::tuple<
+        int32_t,
+        int32_t,
+        int32_t,
+        int32_t,
+        int32_t,
+        int32_t,
+        int32_t,
+        int32_t>;
+
+    constexpr size_t rows = 4096;
+
+    template <class Tup>
+    struct arrays {
+        std::vector<Tup> a, b, c, out;
+
+        arrays()
+          : a(rows)
+          , b(rows)
+          , c(rows)
+          , out(rows) {
+            for (size_t k = 0; k < rows; k++) {
+                a[k].for_each([&](auto& x) { x = k % 17; });
+                b[k].for_each([&](auto& x) { x = k % 5; });
+                c[k].for_each([&](auto& x) { x = k % 3; });
+            }
+        }
+    };
+
+    /// Combines two tuples elementwise into a new tuple, the way a map over
+    /// two tuples is usually written
+    template <class F, class Tup, size_t... I>
+    Tup zip_with(F f, Tup const& x, Tup const& y, std::index_sequence<I...>) {
+        return {f(x[tuplet::tag<I>()], y[tuplet::tag<I>()])...};
+    }
+    template <class F, class Tup>
+    Tup zip_with(F f, Tup const& x, Tup const& y) {
+        return zip_with(f, x, y, std::make_index_sequence<Tup::N>());
+    }
+
+    template <size_t Ops, class Tup, class T>
+    Tup materialized(
+        Tup const& a,
+        Tup const& b,
+        Tup const& c,
+        T s,
+        T lo,
+        T hi) {
+        Tup t = zip_with([](T x, T y) { return T(x - y); }, a, b);
+        t = t.map([s](T x) { return T(x * s); });
+        t = zip_with([](T x, T y) { return T(x + y); }, t, c);
+        if constexpr (Ops >= 4) {
+            t = t.map([hi](T x) { return hi < x ? hi : x; });
+        }
+        if constexpr (Ops >= 5) {
+            t = t.map([lo](T x) { return x < lo ? lo : x; });
+        }
+        return t;
+    }
+
+    template <size_t Ops, class Tup, class T>
+    void fused(
+        Tup& out,
+        Tup const& a,
+        Tup const& b,
+        Tup const& c,
+        T s,
+        T lo,
+        T hi) {
+        using namespace tuplet::elementwise;
+        if constexpr (Ops == 3) {
+            out = (a - b) * s + c;
+        } else if constexpr (Ops == 4) {
+            out = min((a - b) * s + c, hi);
+        } else {
+            out = max(min((a - b) * s + c, hi), lo);
+        }
+    }
+} // namespace
+
+template <size_t Ops, class Tup>
+static void BM_materialized(benchmark::State& state) {
+    using T = std::decay_t<decltype(tuplet::get<0>(std::declval<Tup>()))>;
+    arrays<Tup> data;
+    T s = T(3);
+    T lo = T(0);
+    T hi = T(10);
+    benchmark::DoNotOptimize(lo);
+    benchmark::DoNotOptimize(hi);
+    for (auto _ : state) {
+        for (size_t k = 0; k < rows; k++) {
+            data.out[k] = materialized<Ops>(
+                data.a[k],
+                data.b[k],
+                data.c[k],
+                s,
+                lo,
+                hi);
+        }
+        benchmark::DoNotOptimize(data.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows));
+}
+
+template <size_t Ops, class Tup>
+static void BM_fused(benchmark::State& state) {
+    using T = std::decay_t<decltype(tuplet::get<0>(std::declval<Tup>()))>;
+    arrays<Tup> data;
+    T s = T(3);
+    T lo = T(0);
+    T hi = T(10);
+    benchmark::DoNotOptimize(lo);
+    benchmark::DoNotOptimize(hi);
+    for (auto _ : state) {
+        for (size_t k = 0; k < rows; k++) {
+            fused<Ops>(
+                data.out[k],
+                data.a[k],
+                data.b[k],
+                data.c[k],
+                s,
+                lo,
+                hi);
+        }
+        benchmark::DoNotOptimize(data.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows));
+}
+
+BENCHMARK_TEMPLATE(BM_materialized, 3, float4);
+BENCHMARK_TEMPLATE(BM_fused, 3, float4);
+BENCHMARK_TEMPLATE(BM_materialized, 4, float4);
+BENCHMARK_TEMPLATE(BM_fused, 4, float4);
+BENCHMARK_TEMPLATE(BM_materialized, 5, float4);
+BENCHMARK_TEMPLATE(BM_fused, 5, float4);
+BENCHMARK_TEMPLATE(BM_materialized, 3, int8x);
+BENCHMARK_TEMPLATE(BM_fused, 3, int8x);
+BENCHMARK_TEMPLATE(BM_materialized, 5, int8x);
+BENCHMARK_TEMPLATE(BM_fused, 5, int8x);
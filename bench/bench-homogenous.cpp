@@ -1,8 +1,11 @@
+#include <array>
 #include <benchmark/benchmark.h>
 #include <cstdint>
+#include <random>
 #include <tuple>
 #include <tuplet/tuple.hpp>
 #include <type_traits>
+#include <vector>
 
 #include "shared.hpp"
 
@@ -94,3 +97,94 @@ BENCHMARK_CAPTURE(
     BM_copy,
     homogenous_tuplet_tuple_v1024,
     homogenous_tuplet_tuple_v1024);
+
+
+
+// Runtime indexing: sums rows[k][indices[k]] for 4096 random indices, either
+// with a hand-written switch over tuplet::get, with tuple::operator[](size_t),
+// or from std::arrays holding the same values.
+
+namespace {
+    constexpr size_t index_rows = 4096;
+
+    std::vector<size_t> make_indices() {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<size_t> dist(0, 7);
+        std::vector<size_t> indices(index_rows);
+        for (auto& i : indices) {
+            i = dist(rng);
+        }
+        return indices;
+    }
+
+    std::vector<homo_tuplet_tuple_t> make_rows() {
+        std::vector<homo_tuplet_tuple_t> rows(index_rows);
+        for (size_t k = 0; k < index_rows; k++) {
+            for (size_t i = 0; i < 8; i++) {
+                rows[k][i] = int8_t(k + i);
+            }
+        }
+        return rows;
+    }
+
+    int8_t get_with_switch(homo_tuplet_tuple_t const& tup, size_t i) {
+        switch (i) {
+            case 0: return tuplet::get<0>(tup);
+            case 1: return tuplet::get<1>(tup);
+            case 2: return tuplet::get<2>(tup);
+            case 3: return tuplet::get<3>(tup);
+            case 4: return tuplet::get<4>(tup);
+            case 5: return tuplet::get<5>(tup);
+            case 6: return tuplet::get<6>(tup);
+            default: return tuplet::get<7>(tup);
+        }
+    }
+} // namespace
+
+static void BM_runtime_index_switch(benchmark::State& state) {
+    auto rows = make_rows();
+    auto indices = make_indices();
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (size_t k = 0; k < index_rows; k++) {
+            sum += get_with_switch(rows[k], indices[k]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(index_rows));
+}
+
+static void BM_runtime_index_tuple(benchmark::State& state) {
+    auto rows = make_rows();
+    auto indices = make_indices();
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (size_t k = 0; k < index_rows; k++) {
+            sum += rows[k][indices[k]];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(index_rows));
+}
+
+static void BM_runtime_index_std_array(benchmark::State& state) {
+    std::vector<std::array<int8_t, 8>> rows(index_rows);
+    for (size_t k = 0; k < index_rows; k++) {
+        for (size_t i = 0; i < 8; i++) {
+            rows[k][i] = int8_t(k + i);
+        }
+    }
+    auto indices = make_indices();
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (size_t k = 0; k < index_rows; k++) {
+            sum += rows[k][indices[k]];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(index_rows));
+}
+
+BENCHMARK(BM_runtime_index_switch);
+BENCHMARK(BM_runtime_index_tuple);
+BENCHMARK(BM_runtime_index_std_array);
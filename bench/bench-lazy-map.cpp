@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+// Runs strings through a chain of three functions, for 4096 rows of four
+// strings each, either with map, which builds a tuple after every step, or
+// with lazy_map, which builds only the final tuple. The strings are too
+// long for the small string buffer, so every new string allocates.
+//
+// map moves the elements out of each intermediate tuple, so for strings
+// the chains take about the same time: the allocations dominate. The
+// "first" benchmarks read only element 0 of the result. map computes all
+// four elements anyway, while lazy_map computes just that one.
+
+namespace {
+    using row =
+        tuplet::tuple<std::string, std::string, std::string, std::string>;
+
+    constexpr size_t rows = 4096;
+
+    std::vector<row> make_rows() {
+        std::vector<row> result(rows);
+        for (size_t i = 0; i < rows; i++) {
+            auto name = std::string(32, 'a' + i % 26);
+            result[i] = row {name, name + "1", name + "2", name + "3"};
+        }
+        return result;
+    }
+
+    // Each step takes the string by value, so it can modify a string that's
+    // moved in rather than copying it
+    auto prefix = [](std::string const& s) { return "key:" + s; };
+    auto upper = [](std::string s) {
+        for (auto& c : s) {
+            c = char(c & ~0x20);
+        }
+        return s;
+    };
+    auto suffix = [](std::string s) {
+        s += ";";
+        return s;
+    };
+} // namespace
+
+static void BM_map_chain(benchmark::State& state) {
+    auto in = make_rows();
+    for (auto _ : state) {
+        for (auto const& r : in) {
+            auto out = r.map(prefix).map(upper).map(suffix);
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows));
+}
+
+static void BM_lazy_map_chain(benchmark::State& state) {
+    auto in = make_rows();
+    for (auto _ : state) {
+        for (auto const& r : in) {
+            auto out = r.lazy_map(prefix)
+                           .lazy_map(upper)
+                           .lazy_map(suffix)
+                           .materialize();
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows));
+}
+
+static void BM_map_first(benchmark::State& state) {
+    auto in = make_rows();
+    for (auto _ : state) {
+        for (auto const& r : in) {
+            auto out = tuplet::get<0>(r.map(prefix).map(upper).map(suffix));
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows));
+}
+
+static void BM_lazy_map_first(benchmark::State& state) {
+    auto in = make_rows();
+    for (auto _ : state) {
+        for (auto const& r : in) {
+            auto out = tuplet::get<0>(
+                r.lazy_map(prefix).lazy_map(upper).lazy_map(suffix));
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows));
+}
+
+BENCHMARK(BM_map_chain);
+BENCHMARK(BM_lazy_map_chain);
+BENCHMARK(BM_map_first);
+BENCHMARK(BM_lazy_map_first);
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <tuplet/thread_pool.hpp>
+#include <tuplet/tuple.hpp>
+#include <unordered_map>
+#include <vector>
+
+// Per-element work is deliberately uneven: the first container is 16 times
+// larger than the second, and 256 times larger than the third, so the
+// parallel version can be at most as fast as the largest element.
+
+namespace {
+    using containers = tuplet::tuple<
+        std::vector<double>,
+        std::vector<int64_t>,
+        std::unordered_map<int64_t, float>>;
+
+    containers make_containers() {
+        containers result;
+        auto& [doubles, ints, map] = result;
+        doubles.resize(1 << 20);
+        std::iota(doubles.begin(), doubles.end(), 0.0);
+        ints.resize(1 << 16);
+        std::iota(ints.begin(), ints.end(), 0);
+        for (int64_t i = 0; i < (1 << 12); i++) {
+            map.emplace(i, float(i));
+        }
+        return result;
+    }
+
+    struct summarize {
+        double operator()(std::vector<double> const& values) const {
+            double sum = 0;
+            for (double value : values) {
+                sum += std::sqrt(value);
+            }
+            return sum;
+        }
+        int64_t operator()(std::vector<int64_t> const& values) const {
+            int64_t sum = 0;
+            for (int64_t value : values) {
+                sum += value * value;
+            }
+            return sum;
+        }
+        float operator()(std::unordered_map<int64_t, float> const& map) const {
+            float sum = 0;
+            for (auto const& [key, value] : map) {
+                sum += value;
+            }
+            return sum;
+        }
+    };
+} // namespace
+
+static void BM_map_sequential(benchmark::State& state) {
+    containers tup = make_containers();
+    for (auto _ : state) {
+        auto result = tup.map(summarize {});
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void BM_map_parallel(benchmark::State& state) {
+    tuplet::thread_pool pool(state.range(0));
+    containers tup = make_containers();
+    for (auto _ : state) {
+        auto result = tup.parallel_map(pool, summarize {});
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void BM_for_each_sequential(benchmark::State& state) {
+    containers tup = make_containers();
+    for (auto _ : state) {
+        tup.for_each([](auto& elem) {
+            benchmark::DoNotOptimize(summarize {}(elem));
+        });
+    }
+}
+
+static void BM_for_each_parallel(benchmark::State& state) {
+    tuplet::thread_pool pool(state.range(0));
+    containers tup = make_containers();
+    for (auto _ : state) {
+        tup.parallel_for_each(pool, [](auto& elem) {
+            benchmark::DoNotOptimize(summarize {}(elem));
+        });
+    }
+}
+
+// The argument is the number of worker threads, in addition to the thread
+// running the benchmark
+BENCHMARK(BM_map_sequential)->UseRealTime();
+BENCHMARK(BM_map_parallel)->Arg(0)->Arg(1)->Arg(2)->UseRealTime();
+BENCHMARK(BM_for_each_sequential)->UseRealTime();
+BENCHMARK(BM_for_each_parallel)->Arg(0)->Arg(1)->Arg(2)->UseRealTime();
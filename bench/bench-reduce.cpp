@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <functional>
+#include <tuplet/tuple.hpp>
+#include <utility>
+
+// Sums tuples of N doubles with a fold expression (a chain of N - 1
+// dependent additions) and with tuple::reduce (a tree log2(N) additions
+// deep). The compiler can't reassociate floating-point additions, so the
+// shape of the computation is kept.
+//
+// The latency benchmarks feed each sum back into the last element, which is
+// at the far end of the fold's chain (x0 + (x1 + (... + xN))), so every
+// iteration waits for the previous one to get through the whole chain (or
+// through one path of the tree). The throughput benchmarks don't.
+
+namespace {
+    template <size_t... I>
+    auto make_doubles(std::index_sequence<I...>) {
+        return tuplet::tuple {(double(I) + 1.0)...};
+    }
+
+    struct linear_fold {
+        template <class Tup>
+        double operator()(Tup const& tup) const {
+            return tup.apply([](auto... x) { return (x + ...); });
+        }
+    };
+
+    struct tree_reduce {
+        template <class Tup>
+        double operator()(Tup const& tup) const {
+            return tup.reduce(std::plus<>());
+        }
+    };
+} // namespace
+
+template <size_t N, class Sum>
+static void BM_sum_latency(benchmark::State& state) {
+    auto tup = make_doubles(std::make_index_sequence<N>());
+    for (auto _ : state) {
+        double sum = Sum()(tup);
+        tuplet::get<N - 1>(tup) = sum * 1e-3;
+    }
+    benchmark::DoNotOptimize(tup);
+}
+
+template <size_t N, class Sum>
+static void BM_sum_throughput(benchmark::State& state) {
+    auto tup = make_doubles(std::make_index_sequence<N>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tup);
+        double sum = Sum()(tup);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+template <size_t N>
+static void BM_argmin(benchmark::State& state) {
+    auto tup = make_doubles(std::make_index_sequence<N>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tup);
+        size_t index = tuplet::argmin(tup);
+        benchmark::DoNotOptimize(index);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_sum_latency, 8, linear_fold);
+BENCHMARK_TEMPLATE(BM_sum_latency, 8, tree_reduce);
+BENCHMARK_TEMPLATE(BM_sum_latency, 16, linear_fold);
+BENCHMARK_TEMPLATE(BM_sum_latency, 16, tree_reduce);
+BENCHMARK_TEMPLATE(BM_sum_latency, 32, linear_fold);
+BENCHMARK_TEMPLATE(BM_sum_latency, 32, tree_reduce);
+BENCHMARK_TEMPLATE(BM_sum_latency, 64, linear_fold);
+BENCHMARK_TEMPLATE(BM_sum_latency, 64, tree_reduce);
+
+BENCHMARK_TEMPLATE(BM_sum_throughput, 8, linear_fold);
+BENCHMARK_TEMPLATE(BM_sum_throughput, 8, tree_reduce);
+BENCHMARK_TEMPLATE(BM_sum_throughput, 64, linear_fold);
+BENCHMARK_TEMPLATE(BM_sum_throughput, 64, tree_reduce);
+
+BENCHMARK_TEMPLATE(BM_argmin, 8);
+BENCHMARK_TEMPLATE(BM_argmin, 64);
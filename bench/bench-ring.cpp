@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <tuplet/ring.hpp>
+#include <tuplet/tuple.hpp>
+
+// Moves tuples between threads through an spsc_ring, an mpmc_ring, and a
+// std::queue backed by a std::list (which allocates a node per value)
+// guarded by a std::mutex.
+//
+// Throughput benchmarks run producers on even thread indices and consumers
+// on odd ones; every thread runs the same number of iterations, so each
+// value pushed is also popped. Latency benchmarks bounce a value between
+// two threads and time the round trip.
+
+namespace {
+    using msg_t = tuplet::tuple<uint64_t, uint32_t, uint16_t, double>;
+
+    constexpr size_t capacity = 1024;
+
+    class locked_queue {
+       public:
+        explicit locked_queue(size_t) {}
+
+        size_t push_n(msg_t const* values, size_t count) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < count; i++) {
+                _queue.push(values[i]);
+            }
+            return count;
+        }
+
+        size_t pop_n(msg_t* out, size_t count) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            size_t popped = 0;
+            for (; popped < count && !_queue.empty(); popped++) {
+                out[popped] = _queue.front();
+                _queue.pop();
+            }
+            return popped;
+        }
+
+       private:
+        std::mutex _mutex;
+        std::queue<msg_t, std::list<msg_t>> _queue;
+    };
+
+    template <class Ring>
+    void push_all(Ring& ring, msg_t const* values, size_t count) {
+        while (count != 0) {
+            size_t pushed = ring.push_n(values, count);
+            values += pushed;
+            count -= pushed;
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    template <class Ring>
+    void pop_all(Ring& ring, msg_t* out, size_t count) {
+        while (count != 0) {
+            size_t popped = ring.pop_n(out, count);
+            out += popped;
+            count -= popped;
+            if (popped == 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    tuplet::spsc_ring<msg_t> spsc(capacity);
+    tuplet::mpmc_ring<msg_t> mpmc(capacity);
+    locked_queue locked(capacity);
+
+    tuplet::spsc_ring<msg_t> spsc_pong(capacity);
+    tuplet::mpmc_ring<msg_t> mpmc_pong(capacity);
+    locked_queue locked_pong(capacity);
+} // namespace
+
+/// Each iteration pushes (or pops) a batch of state.range(0) values
+template <class Ring>
+static void BM_throughput(benchmark::State& state, Ring& ring) {
+    size_t batch = size_t(state.range(0));
+    msg_t values[64];
+    for (size_t i = 0; i < batch; i++) {
+        values[i] = {i, uint32_t(i), uint16_t(i), i * 0.25};
+    }
+    bool producer = state.thread_index() % 2 == 0;
+    for (auto _ : state) {
+        if (producer) {
+            push_all(ring, values, batch);
+        } else {
+            pop_all(ring, values, batch);
+            benchmark::DoNotOptimize(values);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(batch));
+}
+
+/// Thread 0 sends a value and waits for thread 1 to send it back
+template <class Ring>
+static void BM_round_trip(benchmark::State& state, Ring& ping, Ring& pong) {
+    msg_t value {1, 2, 3, 4.0};
+    bool sender = state.thread_index() == 0;
+    for (auto _ : state) {
+        if (sender) {
+            push_all(ping, &value, 1);
+            pop_all(pong, &value, 1);
+        } else {
+            pop_all(ping, &value, 1);
+            push_all(pong, &value, 1);
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(BM_throughput, spsc, spsc)
+    ->Arg(1)
+    ->Arg(64)
+    ->Threads(2)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_throughput, mpmc, mpmc)
+    ->Arg(1)
+    ->Arg(64)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_throughput, locked_queue, locked)
+    ->Arg(1)
+    ->Arg(64)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BM_round_trip, spsc, spsc, spsc_pong)
+    ->Threads(2)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_round_trip, mpmc, mpmc, mpmc_pong)
+    ->Threads(2)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_round_trip, locked_queue, locked, locked_pong)
+    ->Threads(2)
+    ->UseRealTime();
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <tuplet/seqlock.hpp>
+#include <tuplet/tuple.hpp>
+
+#include "shared.hpp"
+
+// Reader throughput as reader threads are added, while a background writer
+// updates a 128-byte snapshot as fast as it can. Reads are reported as
+// items per second, and the writer's rate as a counter, for a seqlock_tuple
+// and for a tuple guarded by a std::shared_mutex.
+
+namespace {
+    using snapshot_t = tuplet::tuple<
+        uint64_t,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double,
+        double>;
+    static_assert(sizeof(snapshot_t) == 128);
+
+    template <class Tuple>
+    struct seqlock_for_t;
+    template <class... T>
+    struct seqlock_for_t<tuplet::tuple<T...>> {
+        using type = tuplet::seqlock_tuple<T...>;
+    };
+
+    typename seqlock_for_t<snapshot_t>::type shared_seqlock;
+
+    struct {
+        std::shared_mutex mutex;
+        snapshot_t value {};
+    } shared_locked;
+
+    void update(snapshot_t& snapshot) {
+        tuplet::get<0>(snapshot)++;
+        tuplet::get<1>(snapshot) += 0.5;
+    }
+} // namespace
+
+static void BM_seqlock_read(benchmark::State& state) {
+    {
+        background_writer writer(state, [] { shared_seqlock.write(update); });
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(shared_seqlock.read());
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_seqlock_read_one(benchmark::State& state) {
+    {
+        background_writer writer(state, [] { shared_seqlock.write(update); });
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(shared_seqlock.read<1>());
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_shared_mutex_read(benchmark::State& state) {
+    {
+        background_writer writer(state, [] {
+            std::unique_lock<std::shared_mutex> lock(shared_locked.mutex);
+            update(shared_locked.value);
+        });
+        for (auto _ : state) {
+            snapshot_t copy;
+            {
+                std::shared_lock<std::shared_mutex> lock(shared_locked.mutex);
+                copy = shared_locked.value;
+            }
+            benchmark::DoNotOptimize(copy);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_seqlock_read)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_seqlock_read_one)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_shared_mutex_read)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <tuplet/atomic.hpp>
+#include <tuplet/sharded.hpp>
+#include <tuplet/tuple.hpp>
+
+// Every thread records samples into shared (count, sum, min, max) metrics.
+// The metrics are kept in a tuplet::sharded (one shard per thread), in an
+// atomic_tuple updated with a compare-and-swap loop, and in a tuple guarded
+// by a std::mutex.
+
+namespace {
+    using metrics_t = tuplet::tuple<uint32_t, float, float, float>;
+
+    struct min_fn {
+        float operator()(float a, float b) const { return std::min(a, b); }
+    };
+    struct max_fn {
+        float operator()(float a, float b) const { return std::max(a, b); }
+    };
+
+    constexpr metrics_t identity {
+        0,
+        0.0f,
+        std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::lowest()};
+
+    metrics_t combine(metrics_t const& a, metrics_t const& b) {
+        auto& [count_a, sum_a, min_a, max_a] = a;
+        auto& [count_b, sum_b, min_b, max_b] = b;
+        return {
+            count_a + count_b,
+            sum_a + sum_b,
+            std::min(min_a, min_b),
+            std::max(max_a, max_b)};
+    }
+
+    tuplet::sharded shared_sharded(
+        identity,
+        tuplet::tuple {std::plus<>(), std::plus<>(), min_fn(), max_fn()});
+
+    tuplet::atomic_tuple<uint32_t, float, float, float> shared_atomic(
+        identity);
+
+    struct {
+        std::mutex mutex;
+        metrics_t value = identity;
+    } shared_locked;
+
+    float sample(int64_t i) { return float(i & 1023) * 0.5f; }
+} // namespace
+
+static void BM_sharded(benchmark::State& state) {
+    auto shard = shared_sharded.claim();
+    int64_t i = 0;
+    for (auto _ : state) {
+        float x = sample(i++);
+        shard.add({1, x, x, x});
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_atomic_tuple_cas(benchmark::State& state) {
+    int64_t i = 0;
+    for (auto _ : state) {
+        float x = sample(i++);
+        metrics_t current = shared_atomic.load(std::memory_order_relaxed);
+        while (!shared_atomic.compare_exchange_weak(
+            current,
+            combine(current, {1, x, x, x}))) {
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_mutex(benchmark::State& state) {
+    int64_t i = 0;
+    for (auto _ : state) {
+        float x = sample(i++);
+        std::lock_guard<std::mutex> lock(shared_locked.mutex);
+        shared_locked.value = combine(shared_locked.value, {1, x, x, x});
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_sharded)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_atomic_tuple_cas)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_mutex)->ThreadRange(1, 8)->UseRealTime();
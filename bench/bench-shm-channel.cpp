@@ -0,0 +1,122 @@
+#if __has_include(<sys/mman.h>)
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <tuplet/shm_channel.hpp>
+#include <tuplet/tuple.hpp>
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Sends rows to a forked child process, through a tuplet::shm_channel, and
+// through a Unix domain socket. Each iteration sends a batch of
+// state.range(0) rows; the child receives exactly as many rows as the
+// benchmark will send.
+
+namespace {
+    using row_t = tuplet::tuple<uint64_t, uint32_t, uint16_t, double>;
+    using channel_t = tuplet::shm_channel<row_t>;
+
+    void fill(row_t* rows, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            rows[i] = {i, uint32_t(i), uint16_t(i), i * 0.25};
+        }
+    }
+
+    void wait_for(pid_t child, benchmark::State& state) {
+        int status = 0;
+        if (waitpid(child, &status, 0) != child || !WIFEXITED(status)
+            || WEXITSTATUS(status) != 0) {
+            state.SkipWithError("the receiving process failed");
+        }
+    }
+} // namespace
+
+static void BM_shm_channel(benchmark::State& state) {
+    size_t batch = size_t(state.range(0));
+    uint64_t total = uint64_t(state.max_iterations) * batch;
+    std::string name = "/tuplet-bench-" + std::to_string(getpid());
+    channel_t::remove(name);
+    auto tx = channel_t::create(name, 4096);
+
+    pid_t child = fork();
+    if (child == 0) {
+        auto rx = channel_t::attach(name);
+        uint64_t received = 0;
+        while (received < total) {
+            auto rows = rx.wait_readable();
+            benchmark::DoNotOptimize(rows.data());
+            received += rows.size();
+            rx.consume(rows.size());
+        }
+        _exit(0);
+    }
+
+    row_t rows[64];
+    fill(rows, batch);
+    for (auto _ : state) {
+        row_t const* next = rows;
+        size_t left = batch;
+        while (left != 0) {
+            size_t sent = tx.send_n(next, left);
+            if (sent == 0) {
+                tx.send(*next);
+                sent = 1;
+            }
+            next += sent;
+            left -= sent;
+        }
+    }
+    wait_for(child, state);
+    channel_t::remove(name);
+    state.SetItemsProcessed(state.iterations() * int64_t(batch));
+}
+
+static void BM_unix_socket(benchmark::State& state) {
+    size_t batch = size_t(state.range(0));
+    uint64_t total = uint64_t(state.max_iterations) * batch * sizeof(row_t);
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        state.SkipWithError("socketpair failed");
+        return;
+    }
+
+    pid_t child = fork();
+    if (child == 0) {
+        close(fds[0]);
+        row_t rows[64];
+        uint64_t received = 0;
+        while (received < total) {
+            ssize_t n = read(fds[1], rows, sizeof(rows));
+            if (n <= 0) {
+                _exit(1);
+            }
+            received += uint64_t(n);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+
+    row_t rows[64];
+    fill(rows, batch);
+    for (auto _ : state) {
+        auto const* bytes = reinterpret_cast<char const*>(rows);
+        size_t left = batch * sizeof(row_t);
+        while (left != 0) {
+            ssize_t n = write(fds[0], bytes, left);
+            if (n <= 0) {
+                break;
+            }
+            bytes += n;
+            left -= size_t(n);
+        }
+    }
+    close(fds[0]);
+    wait_for(child, state);
+    state.SetItemsProcessed(state.iterations() * int64_t(batch));
+}
+
+BENCHMARK(BM_shm_channel)->Arg(1)->Arg(64)->UseRealTime();
+BENCHMARK(BM_unix_socket)->Arg(1)->Arg(64)->UseRealTime();
+#endif
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuplet/sort.hpp>
+#include <utility>
+#include <vector>
+
+// Sorts 4096 rows of N random values, either as tuples with
+// tuplet::sorted (a sorting network) or as std::arrays with std::sort. Each
+// row is copied before it's sorted, so every iteration sorts the same
+// unsorted input.
+
+namespace {
+    template <class T, size_t I>
+    using always_t = T;
+
+    template <class T, size_t... I>
+    auto repeat(std::index_sequence<I...>) -> tuplet::tuple<always_t<T, I>...>;
+
+    template <class T, size_t N>
+    using tuple_n = decltype(repeat<T>(std::make_index_sequence<N>()));
+
+    constexpr size_t rows = 4096;
+
+    template <class T, size_t N>
+    std::vector<std::array<T, N>> make_arrays() {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> dist(0, 1 << 20);
+        std::vector<std::array<T, N>> arrays(rows);
+        for (auto& arr : arrays) {
+            for (auto& x : arr) {
+                x = T(dist(rng));
+            }
+        }
+        return arrays;
+    }
+
+    template <class T, size_t N, size_t... I>
+    tuple_n<T, N> to_tuple(
+        std::array<T, N> const& arr,
+        std::index_sequence<I...>) {
+        return {arr[I]...};
+    }
+} // namespace
+
+template <class T, size_t N>
+static void BM_std_sort(benchmark::State& state) {
+    auto in = make_arrays<T, N>();
+    std::vector<std::array<T, N>> out(rows);
+    for (auto _ : state) {
+        for (size_t k = 0; k < rows; k++) {
+            auto arr = in[k];
+            std::sort(arr.begin(), arr.end());
+            out[k] = arr;
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows));
+}
+
+template <class T, size_t N>
+static void BM_sort_network(benchmark::State& state) {
+    auto arrays = make_arrays<T, N>();
+    std::vector<tuple_n<T, N>> in(rows), out(rows);
+    for (size_t k = 0; k < rows; k++) {
+        in[k] = to_tuple(arrays[k], std::make_index_sequence<N>());
+    }
+    for (auto _ : state) {
+        for (size_t k = 0; k < rows; k++) {
+            out[k] = tuplet::sorted(in[k]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(rows));
+}
+
+BENCHMARK_TEMPLATE(BM_std_sort, int32_t, 4);
+BENCHMARK_TEMPLATE(BM_sort_network, int32_t, 4);
+BENCHMARK_TEMPLATE(BM_std_sort, int32_t, 8);
+BENCHMARK_TEMPLATE(BM_sort_network, int32_t, 8);
+BENCHMARK_TEMPLATE(BM_std_sort, int32_t, 12);
+BENCHMARK_TEMPLATE(BM_sort_network, int32_t, 12);
+BENCHMARK_TEMPLATE(BM_std_sort, int32_t, 16);
+BENCHMARK_TEMPLATE(BM_sort_network, int32_t, 16);
+BENCHMARK_TEMPLATE(BM_std_sort, float, 4);
+BENCHMARK_TEMPLATE(BM_sort_network, float, 4);
+BENCHMARK_TEMPLATE(BM_std_sort, float, 16);
+BENCHMARK_TEMPLATE(BM_sort_network, float, 16);
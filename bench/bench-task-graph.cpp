@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <future>
+#include <tuplet/task_graph.hpp>
+#include <tuplet/work_stealing_pool.hpp>
+#include <utility>
+#include <vector>
+
+// A wide DAG of small tasks: one source node, Width independent nodes that
+// each take the source's output, and one sink that sums them. The work in
+// each node is trivial, so the time per node is the scheduler's overhead.
+// The same DAG wired up by hand with std::async and futures is shown for
+// comparison.
+
+namespace {
+    constexpr size_t width = 64;
+
+    struct source {
+        int64_t operator()() const { return 1; }
+    };
+    struct middle {
+        int64_t offset;
+        int64_t operator()(int64_t input) const { return input + offset; }
+    };
+    struct sink {
+        template <class... T>
+        int64_t operator()(T const&... values) const {
+            return (values + ...);
+        }
+    };
+
+    template <size_t... I>
+    auto make_wide_graph(std::index_sequence<I...>) {
+        return tuplet::task_graph {
+            tuplet::node(source {}),
+            tuplet::node(middle {int64_t(I)}, tuplet::inputs<0>)...,
+            tuplet::node(sink {}, tuplet::inputs<(I + 1)...>)};
+    }
+} // namespace
+
+static void BM_task_graph_wide(benchmark::State& state) {
+    tuplet::work_stealing_pool pool(state.range(0));
+    auto graph = make_wide_graph(std::make_index_sequence<width>());
+    for (auto _ : state) {
+        auto results = graph.run(pool);
+        benchmark::DoNotOptimize(results);
+    }
+    state.SetItemsProcessed(state.iterations() * (width + 2));
+}
+
+static void BM_futures_wide(benchmark::State& state) {
+    for (auto _ : state) {
+        auto first = std::async(std::launch::async, source {}).share();
+        std::vector<std::future<int64_t>> middles;
+        middles.reserve(width);
+        for (size_t i = 0; i < width; i++) {
+            middles.push_back(std::async(std::launch::async, [first, i] {
+                return middle {int64_t(i)}(first.get());
+            }));
+        }
+        int64_t sum = 0;
+        for (auto& result : middles) {
+            sum += result.get();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (width + 2));
+}
+
+// The argument is the number of worker threads, in addition to the thread
+// running the benchmark
+BENCHMARK(BM_task_graph_wide)->Arg(0)->Arg(1)->Arg(3)->UseRealTime();
+BENCHMARK(BM_futures_wide)->UseRealTime();
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+// Compares the two tuple_cat strategies across element categories. For
+// trivially copyable elements the two strategies perform the same; for
+// elements that are expensive to move, by_forwarding_tuple avoids a move per
+// element. The automatic strategy picks between them on that basis.
+
+using tuplet::cat_strategy;
+using tuplet::get;
+using tuplet::tuple;
+
+template <cat_strategy Strategy>
+void BM_tuple_cat_trivial(benchmark::State& state) {
+    tuple<int32_t, int32_t, double> a {1, 2, 3.0};
+    tuple<int8_t, float> b {4, 5.0f};
+    tuple<int64_t> c {6};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(c);
+        auto result = tuplet::tuple_cat<Strategy>(a, b, c);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+template <cat_strategy Strategy>
+void BM_tuple_cat_move_only(benchmark::State& state) {
+    using ptr = std::unique_ptr<int>;
+    tuple<ptr, ptr> a {std::make_unique<int>(1), std::make_unique<int>(2)};
+    tuple<ptr> b {std::make_unique<int>(3)};
+    for (auto _ : state) {
+        auto result = tuplet::tuple_cat<Strategy>(std::move(a), std::move(b));
+        benchmark::DoNotOptimize(result);
+        // Move the elements back, so that the next iteration has inputs
+        tuplet::tie(get<0>(a), get<1>(a), get<0>(b)) = std::move(result);
+    }
+}
+
+template <cat_strategy Strategy>
+void BM_tuple_cat_large_move(benchmark::State& state) {
+    using buffer = std::vector<int64_t>;
+    tuple<buffer, std::string> a {buffer(1024), std::string(1024, 'a')};
+    tuple<buffer> b {buffer(1024)};
+    for (auto _ : state) {
+        auto result = tuplet::tuple_cat<Strategy>(std::move(a), std::move(b));
+        benchmark::DoNotOptimize(result);
+        tuplet::tie(get<0>(a), get<1>(a), get<0>(b)) = std::move(result);
+    }
+}
+
+template <cat_strategy Strategy>
+void BM_tuple_cat_large_copy(benchmark::State& state) {
+    using buffer = std::vector<int64_t>;
+    tuple<buffer, std::string> a {buffer(1024), std::string(1024, 'a')};
+    tuple<buffer> b {buffer(1024)};
+    for (auto _ : state) {
+        auto result = tuplet::tuple_cat<Strategy>(a, b);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_tuple_cat_trivial, cat_strategy::by_forwarding_tuple);
+BENCHMARK_TEMPLATE(BM_tuple_cat_trivial, cat_strategy::by_value);
+BENCHMARK_TEMPLATE(BM_tuple_cat_trivial, cat_strategy::automatic);
+BENCHMARK_TEMPLATE(BM_tuple_cat_move_only, cat_strategy::by_forwarding_tuple);
+BENCHMARK_TEMPLATE(BM_tuple_cat_move_only, cat_strategy::by_value);
+BENCHMARK_TEMPLATE(BM_tuple_cat_move_only, cat_strategy::automatic);
+BENCHMARK_TEMPLATE(BM_tuple_cat_large_move, cat_strategy::by_forwarding_tuple);
+BENCHMARK_TEMPLATE(BM_tuple_cat_large_move, cat_strategy::by_value);
+BENCHMARK_TEMPLATE(BM_tuple_cat_large_move, cat_strategy::automatic);
+BENCHMARK_TEMPLATE(BM_tuple_cat_large_copy, cat_strategy::by_forwarding_tuple);
+BENCHMARK_TEMPLATE(BM_tuple_cat_large_copy, cat_strategy::by_value);
+BENCHMARK_TEMPLATE(BM_tuple_cat_large_copy, cat_strategy::automatic);
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <tuplet/tuple.hpp>
+#include <tuplet/versioned.hpp>
+#include <vector>
+
+#include "shared.hpp"
+
+// Latency of lookups in a routing table while a background writer keeps
+// publishing new versions of it. The table is a vector of tuples, either in
+// a tuplet::versioned, or swapped under a std::shared_mutex (the writer
+// builds the new table outside the lock, and only holds it for the swap).
+// Each lookup is timed, and the median and 99th percentile are reported in
+// nanoseconds.
+
+namespace {
+    using route = tuplet::tuple<uint32_t, uint32_t, double>;
+    using table_t = std::vector<route>;
+
+    constexpr uint32_t table_size = 1024;
+
+    table_t make_table(uint32_t generation) {
+        table_t table(table_size);
+        for (uint32_t i = 0; i < table_size; i++) {
+            table[i] = {i, generation, 1.0};
+        }
+        return table;
+    }
+
+    double lookup(table_t const& table, uint32_t key) {
+        auto const& [id, generation, weight] = table[key % table.size()];
+        return id + generation * weight;
+    }
+
+    /// Records the duration of each operation, and reports percentiles
+    class latency_recorder {
+       public:
+        template <class F>
+        void time(F&& func) {
+            auto start = std::chrono::steady_clock::now();
+            func();
+            auto end = std::chrono::steady_clock::now();
+            _samples.push_back(
+                std::chrono::duration<double, std::nano>(end - start).count());
+        }
+
+        void report(benchmark::State& state) {
+            std::sort(_samples.begin(), _samples.end());
+            auto percentile = [&](double p) {
+                return _samples[size_t(p * double(_samples.size() - 1))];
+            };
+            state.counters["p50_ns"] = benchmark::Counter(
+                percentile(0.5),
+                benchmark::Counter::kAvgThreads);
+            state.counters["p99_ns"] = benchmark::Counter(
+                percentile(0.99),
+                benchmark::Counter::kAvgThreads);
+        }
+
+       private:
+        std::vector<double> _samples;
+    };
+
+    tuplet::versioned<table_t> shared_versioned(make_table(0));
+
+    struct {
+        std::shared_mutex mutex;
+        std::unique_ptr<table_t> table = std::make_unique<table_t>(
+            make_table(0));
+    } shared_locked;
+} // namespace
+
+static void BM_versioned_lookup(benchmark::State& state) {
+    latency_recorder latency;
+    uint32_t generation = 0;
+    {
+        background_writer writer(state, [&] {
+            shared_versioned.publish(make_table(++generation));
+        });
+        auto reader = shared_versioned.reader();
+        uint32_t key = 0;
+        for (auto _ : state) {
+            latency.time([&] {
+                auto table = reader.pin();
+                benchmark::DoNotOptimize(lookup(*table, key++));
+            });
+        }
+    }
+    latency.report(state);
+}
+
+static void BM_shared_mutex_lookup(benchmark::State& state) {
+    latency_recorder latency;
+    uint32_t generation = 0;
+    {
+        background_writer writer(state, [&] {
+            auto next = std::make_unique<table_t>(make_table(++generation));
+            {
+                std::unique_lock<std::shared_mutex> lock(shared_locked.mutex);
+                std::swap(shared_locked.table, next);
+            }
+        });
+        uint32_t key = 0;
+        for (auto _ : state) {
+            latency.time([&] {
+                std::shared_lock<std::shared_mutex> lock(shared_locked.mutex);
+                benchmark::DoNotOptimize(lookup(*shared_locked.table, key++));
+            });
+        }
+    }
+    latency.report(state);
+}
+
+BENCHMARK(BM_versioned_lookup)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK(BM_shared_mutex_lookup)->ThreadRange(1, 4)->UseRealTime();
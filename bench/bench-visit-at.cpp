@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuplet/runtime_index.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Reads the field with a runtime index out of a row of N mixed-type fields,
+// either with tuplet::visit_at (one indirect call through a table) or with a
+// chain of if (i == I) checks, which takes up to N comparisons. There are
+// 65536 random indices, so that the branch predictor can't learn them.
+//
+// Either way, there's about one mispredicted branch per lookup. At N = 8,
+// the chain is slightly faster, since the compiler inlines it; from N = 32
+// on, the comparisons dominate, and visit_at's time doesn't change with N.
+
+namespace {
+    template <size_t I>
+    using field_t = std::conditional_t<
+        I % 4 == 0,
+        int32_t,
+        std::conditional_t<
+            I % 4 == 1,
+            double,
+            std::conditional_t<I % 4 == 2, int64_t, float>>>;
+
+    template <size_t... I>
+    auto make_row(std::index_sequence<I...>) {
+        return tuplet::tuple<field_t<I>...> {field_t<I>(I)...};
+    }
+
+    template <size_t N>
+    using row_t = decltype(make_row(std::make_index_sequence<N>()));
+
+    constexpr size_t lookups = 1 << 16;
+
+    template <size_t N>
+    std::vector<size_t> make_indices() {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<size_t> dist(0, N - 1);
+        std::vector<size_t> indices(lookups);
+        for (auto& i : indices) {
+            i = dist(rng);
+        }
+        return indices;
+    }
+
+    struct to_double {
+        template <class T>
+        double operator()(T const& value) const {
+            return double(value);
+        }
+    };
+
+    template <size_t I, class Tup, class F>
+    double linear_visit(Tup const& tup, size_t i, F func) {
+        if constexpr (I + 1 == Tup::N) {
+            return func(tuplet::get<I>(tup));
+        } else {
+            if (i == I) {
+                return func(tuplet::get<I>(tup));
+            }
+            return linear_visit<I + 1>(tup, i, func);
+        }
+    }
+} // namespace
+
+template <size_t N>
+static void BM_linear_chain(benchmark::State& state) {
+    auto row = make_row(std::make_index_sequence<N>());
+    auto indices = make_indices<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(row);
+        double sum = 0;
+        for (size_t i : indices) {
+            sum += linear_visit<0>(row, i, to_double());
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(lookups));
+}
+
+template <size_t N>
+static void BM_visit_at(benchmark::State& state) {
+    auto row = make_row(std::make_index_sequence<N>());
+    auto indices = make_indices<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(row);
+        double sum = 0;
+        for (size_t i : indices) {
+            sum += tuplet::visit_at(row, i, to_double());
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(lookups));
+}
+
+BENCHMARK_TEMPLATE(BM_linear_chain, 8);
+BENCHMARK_TEMPLATE(BM_visit_at, 8);
+BENCHMARK_TEMPLATE(BM_linear_chain, 32);
+BENCHMARK_TEMPLATE(BM_visit_at, 32);
+BENCHMARK_TEMPLATE(BM_linear_chain, 128);
+BENCHMARK_TEMPLATE(BM_visit_at, 128);
@@ -0,0 +1,111 @@
+#include <tuplet/when_all.hpp>
+
+#if __cpp_impl_coroutine
+#include "../test/util/event_loop.hpp"
+#include <benchmark/benchmark.h>
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+
+// Compares tuplet::when_all against the hand-written pattern it replaces:
+// results collected into a heap-allocated std::tuple of optionals, with a
+// mutex-guarded count of outstanding calls. Each leaf suspends once on the
+// event loop, so that every child really does finish asynchronously.
+
+using loop::event_loop;
+using loop::task;
+
+namespace {
+    task<int> leaf_int(event_loop& loop, int value) {
+        co_await loop.yield();
+        co_return value;
+    }
+
+    task<std::string> leaf_string(event_loop& loop) {
+        co_await loop.yield();
+        co_return std::string("result");
+    }
+
+    task<int> with_when_all(event_loop& loop) {
+        auto [a, b, c] = co_await tuplet::when_all(
+            leaf_int(loop, 1),
+            leaf_int(loop, 2),
+            leaf_string(loop));
+        co_return a + b + int(c.size());
+    }
+
+    /// Results and bookkeeping shared by the calls of the hand-written
+    /// version, allocated separately from any coroutine frame
+    struct shared_state {
+        std::tuple<std::optional<int>, std::optional<int>, std::optional<std::string>>
+            results;
+        std::mutex mutex;
+        int remaining = 3;
+        std::coroutine_handle<> parent;
+
+        void finish() {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (--remaining == 0) {
+                lock.unlock();
+                parent.resume();
+            }
+        }
+    };
+
+    /// Fire-and-forget coroutine, destroyed when it finishes
+    struct detached {
+        struct promise_type {
+            detached get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    template <size_t I, class T>
+    detached store(std::shared_ptr<shared_state> state, task<T> t) {
+        std::get<I>(state->results).emplace(co_await t);
+        state->finish();
+    }
+
+    task<int> hand_written(event_loop& loop) {
+        auto state = std::make_shared<shared_state>();
+        struct start_all {
+            event_loop& loop;
+            std::shared_ptr<shared_state> const& state;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> parent) {
+                state->parent = parent;
+                store<0>(state, leaf_int(loop, 1));
+                store<1>(state, leaf_int(loop, 2));
+                store<2>(state, leaf_string(loop));
+            }
+            void await_resume() const noexcept {}
+        };
+        co_await start_all {loop, state};
+        auto& [a, b, c] = state->results;
+        co_return *a + *b + int(c->size());
+    }
+} // namespace
+
+static void BM_when_all_tuplet(benchmark::State& state) {
+    event_loop loop;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(loop.run(with_when_all(loop)));
+    }
+}
+
+static void BM_when_all_hand_written(benchmark::State& state) {
+    event_loop loop;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(loop.run(hand_written(loop)));
+    }
+}
+
+BENCHMARK(BM_when_all_tuplet);
+BENCHMARK(BM_when_all_hand_written);
+#endif
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <deque>
+#include <tuplet/zip.hpp>
+#include <vector>
+
+// y += a * x over float vectors, written as a loop over an index, as a loop
+// over tuplet::zip, and with tuplet::zip_for_each. Over contiguous ranges,
+// all three should compile to the same vectorized loop. The same loop over
+// deques shows the fallback for ranges that aren't contiguous.
+
+namespace {
+    constexpr float a = 1.5f;
+
+    template <class Container>
+    struct saxpy_data {
+        Container x;
+        Container y;
+
+        explicit saxpy_data(size_t size)
+          : x(size, 1.0f)
+          , y(size, 2.0f) {}
+    };
+} // namespace
+
+static void BM_saxpy_index_loop(benchmark::State& state) {
+    saxpy_data<std::vector<float>> data(state.range(0));
+    for (auto _ : state) {
+        float* x = data.x.data();
+        float* y = data.y.data();
+        size_t size = data.y.size();
+        for (size_t i = 0; i < size; i++) {
+            y[i] += a * x[i];
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_saxpy_zip(benchmark::State& state) {
+    saxpy_data<std::vector<float>> data(state.range(0));
+    for (auto _ : state) {
+        for (auto [x, y] : tuplet::zip(data.x, data.y)) {
+            y += a * x;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_saxpy_zip_for_each(benchmark::State& state) {
+    saxpy_data<std::vector<float>> data(state.range(0));
+    for (auto _ : state) {
+        tuplet::zip_for_each(
+            [](float x, float& y) { y += a * x; },
+            data.x,
+            data.y);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_saxpy_deque_iterator_loop(benchmark::State& state) {
+    saxpy_data<std::deque<float>> data(state.range(0));
+    for (auto _ : state) {
+        auto x = data.x.begin();
+        for (auto y = data.y.begin(); y != data.y.end(); ++x, ++y) {
+            *y += a * *x;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_saxpy_deque_zip(benchmark::State& state) {
+    saxpy_data<std::deque<float>> data(state.range(0));
+    for (auto _ : state) {
+        for (auto [x, y] : tuplet::zip(data.x, data.y)) {
+            y += a * x;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_saxpy_index_loop)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_saxpy_zip)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_saxpy_zip_for_each)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_saxpy_deque_iterator_loop)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_saxpy_deque_zip)->Arg(1 << 10)->Arg(1 << 16);
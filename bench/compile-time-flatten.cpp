@@ -0,0 +1,54 @@
+#include <cstddef>
+#include <tuplet/tuple.hpp>
+#include <utility>
+
+// Measures how long it takes to compile flatten on a deeply nested tuple.
+// This file isn't part of the bench executable: the bench_compile_time
+// target compiles it with -fsyntax-only at several depths, and prints the
+// time each one takes.
+//
+// nest<D> has 2 * D + 1 leaves, D levels deep. With -DTUPLET_FLATTEN_NAIVE,
+// the tuple is flattened the obvious way instead: flatten each element,
+// then tuple_cat the results, which instantiates tuple_cat once per level
+// and builds a temporary at each one.
+
+#ifndef TUPLET_FLATTEN_DEPTH
+#define TUPLET_FLATTEN_DEPTH 32
+#endif
+
+namespace {
+    template <size_t D>
+    struct nest_t {
+        using type =
+            tuplet::tuple<int, typename nest_t<D - 1>::type, float>;
+    };
+    template <>
+    struct nest_t<0> {
+        using type = tuplet::tuple<int>;
+    };
+
+    template <size_t D>
+    using nest = typename nest_t<D>::type;
+
+#if TUPLET_FLATTEN_NAIVE
+    template <class T>
+    auto naive_flatten(T&& value) {
+        return tuplet::tuple {static_cast<T&&>(value)};
+    }
+    template <class... T>
+    auto naive_flatten(tuplet::tuple<T...>&& tup) {
+        return std::move(tup).apply([](auto&&... elems) {
+            return tuplet::tuple_cat(
+                naive_flatten(static_cast<decltype(elems)&&>(elems))...);
+        });
+    }
+#endif
+} // namespace
+
+auto flatten_nest(nest<TUPLET_FLATTEN_DEPTH>&& tup) {
+#if TUPLET_FLATTEN_NAIVE
+    return naive_flatten(std::move(tup));
+#else
+    return tuplet::flatten(std::move(tup));
+#endif
+}
@@ -1,5 +1,8 @@
 #pragma once
+#include <atomic>
 #include <benchmark/benchmark.h>
+#include <cstdint>
+#include <thread>
 
 template <class T>
 void BM_copy(benchmark::State& state, T value) {
@@ -9,3 +12,37 @@ void BM_copy(benchmark::State& state, T value) {
         benchmark::DoNotOptimize(dest);
     }
 }
+
+/// Runs write() on a separate thread until the benchmark finishes.
+/// Started and stopped by the first benchmark thread
+template <class Write>
+class background_writer {
+   public:
+    background_writer(benchmark::State& state, Write write)
+      : _state(state) {
+        if (_state.thread_index() == 0) {
+            _thread = std::thread([this, write] {
+                while (!_done.load(std::memory_order_relaxed)) {
+                    write();
+                    _writes++;
+                }
+            });
+        }
+    }
+
+    ~background_writer() {
+        if (_thread.joinable()) {
+            _done = true;
+            _thread.join();
+            _state.counters["writes"] = benchmark::Counter(
+                double(_writes),
+                benchmark::Counter::kIsRate);
+        }
+    }
+
+   private:
+    benchmark::State& _state;
+    std::atomic<bool> _done {false};
+    int64_t _writes = 0;
+    std::thread _thread;
+};
@@ -0,0 +1,97 @@
+# Checks the assembly produced from test/codegen/probes.cpp. Invoked by CTest
+# as:
+#
+#   cmake -DASM_FILE=<path to assembly> -P check_codegen.cmake
+#
+# Each probe_* function is extracted from the assembly, and then checked
+# against the properties listed at the bottom of this file. Any failure is
+# reported and causes the script to exit with an error.
+
+if(NOT DEFINED ASM_FILE OR NOT EXISTS "${ASM_FILE}")
+    message(FATAL_ERROR "check_codegen: ASM_FILE not found: '${ASM_FILE}'")
+endif()
+
+file(STRINGS "${ASM_FILE}" asm_lines)
+
+set(codegen_failures 0)
+
+# Sets ${out_var} to the body of the given probe, as a list of lines
+function(get_probe_body probe out_var)
+    set(body "")
+    set(in_probe OFF)
+    foreach(line IN LISTS asm_lines)
+        if(in_probe)
+            if(line MATCHES "\\.cfi_endproc|\\.size[ \t]+_?${probe},")
+                break()
+            endif()
+            list(APPEND body "${line}")
+        elseif(line MATCHES "^_?${probe}:")
+            set(in_probe ON)
+        endif()
+    endforeach()
+    if(NOT in_probe)
+        message(SEND_ERROR "check_codegen: ${probe} not found in ${ASM_FILE}")
+    endif()
+    set(${out_var}
+        "${body}"
+        PARENT_SCOPE)
+endfunction()
+
+# Fails if any line of the probe matches the given regex
+function(expect_none probe description regex)
+    get_probe_body(${probe} body)
+    foreach(line IN LISTS body)
+        if(line MATCHES "${regex}")
+            message(
+                SEND_ERROR
+                    "check_codegen: ${probe}: expected ${description}, found '${line}'"
+            )
+            return()
+        endif()
+    endforeach()
+    message(STATUS "check_codegen: ${probe}: ${description}")
+endfunction()
+
+# Fails if no line of the probe matches the given regex
+function(expect_some probe description regex)
+    get_probe_body(${probe} body)
+    foreach(line IN LISTS body)
+        if(line MATCHES "${regex}")
+            message(STATUS "check_codegen: ${probe}: ${description}")
+            return()
+        endif()
+    endforeach()
+    message(SEND_ERROR "check_codegen: ${probe}: expected ${description}")
+endfunction()
+
+# Any memory operand addressed relative to the stack or frame pointer means
+# that something was spilled
+set(stack_access "\\(%[re]?(sp|bp)\\)")
+set(any_call "^[ \t]*call")
+
+foreach(
+    probe
+    probe_pass_tuple
+    probe_return_tuple
+    probe_apply
+    probe_tuple_cat)
+    expect_none(${probe} "no stack access" "${stack_access}")
+    expect_none(${probe} "no calls" "${any_call}")
+endforeach()
+
+expect_none(probe_get "no calls" "${any_call}")
+expect_none(probe_get "no stack access" "${stack_access}")
+
+# A vector copy should either call memcpy/memmove, or be lowered to a vector
+# loop by the compiler
+expect_some(
+    probe_copy_vector
+    "copy via memcpy, memmove, or a vector loop"
+    "call[ \t]+_?(memcpy|memmove)|movdq[au]|vmovdq[au]|movup[sd]|vmovup[sd]")
+
+# Sorting networks over numbers should have no branches, not even for floats
+# (where a comparison used for both outputs tends to become one)
+foreach(probe probe_sort_ints probe_sort_floats probe_sort_floats_descending)
+    expect_none(${probe} "no branches" "^[ \t]*j[a-z]*[ \t]")
+    expect_none(${probe} "no calls" "${any_call}")
+endforeach()
@@ -0,0 +1,459 @@
+#ifndef TUPLET_ATOMIC_HPP_IMPLEMENTATION
+#define TUPLET_ATOMIC_HPP_IMPLEMENTATION
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <tuplet/layout.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/**
+ * TUPLET_HAS_DOUBLE_WIDTH_CAS is 1 when the target has a lock-free 16-byte
+ * compare-and-swap (cmpxchg16b on x86-64, casp or ldxp/stxp on AArch64).
+ *
+ * GCC and Clang only advertise it on x86-64 when compiling with -mcx16 (or
+ * an -march that implies it). Without it, 16-byte tuplet::atomic_tuple falls
+ * back to a spinlock, and atomic_tuple::is_always_lock_free is false.
+ */
+#if !defined(TUPLET_HAS_DOUBLE_WIDTH_CAS)
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && defined(__SIZEOF_INT128__)
+#define TUPLET_HAS_DOUBLE_WIDTH_CAS 1
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define TUPLET_HAS_DOUBLE_WIDTH_CAS 1
+#else
+#define TUPLET_HAS_DOUBLE_WIDTH_CAS 0
+#endif
+#endif
+
+
+
+
+
+////////////////////////////////////////
+////  tuplet::detail: Atomic Words  ////
+////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// A single 8-byte word, which every supported target can update
+    /// atomically
+    struct _atomic_word8 {
+        using value_type = uint64_t;
+        constexpr static bool is_lock_free = true;
+
+        std::atomic<uint64_t> word;
+
+        value_type load(std::memory_order order) const noexcept {
+            return word.load(order);
+        }
+        value_type guess() const noexcept {
+            return word.load(std::memory_order_relaxed);
+        }
+        void store(value_type value, std::memory_order order) noexcept {
+            word.store(value, order);
+        }
+        value_type exchange(value_type value, std::memory_order order) noexcept {
+            return word.exchange(value, order);
+        }
+        bool compare_exchange_weak(
+            value_type& expected,
+            value_type desired,
+            std::memory_order success,
+            std::memory_order failure) noexcept {
+            return word.compare_exchange_weak(
+                expected,
+                desired,
+                success,
+                failure);
+        }
+        bool compare_exchange_strong(
+            value_type& expected,
+            value_type desired,
+            std::memory_order success,
+            std::memory_order failure) noexcept {
+            return word.compare_exchange_strong(
+                expected,
+                desired,
+                success,
+                failure);
+        }
+    };
+
+#if TUPLET_HAS_DOUBLE_WIDTH_CAS
+#if defined(_MSC_VER) && !defined(__clang__)
+    struct alignas(16) _word16 {
+        long long low;
+        long long high;
+
+        bool operator==(_word16 const& other) const noexcept {
+            return low == other.low && high == other.high;
+        }
+    };
+
+    inline bool _cas16(_word16* word, _word16& expected, _word16 desired) {
+        return _InterlockedCompareExchange128(
+            &word->low,
+            desired.high,
+            desired.low,
+            &expected.low);
+    }
+#else
+    using _word16 = unsigned __int128;
+    using _word16_half [[gnu::may_alias]] = uint64_t;
+
+    /// The __sync builtins compile to a single cmpxchg16b. The __atomic
+    /// builtins would call into libatomic instead
+    inline bool _cas16(_word16* word, _word16& expected, _word16 desired) {
+        _word16 previous = __sync_val_compare_and_swap(word, expected, desired);
+        bool success = previous == expected;
+        expected = previous;
+        return success;
+    }
+#endif
+
+    /// A 16-byte word updated with a double-width compare-and-swap. The
+    /// instruction is a full barrier, so every memory order is satisfied.
+    /// Loads are also done with a compare-and-swap, since x86-64 has no
+    /// 16-byte atomic load; the word is mutable so that loads can be const
+    struct _atomic_word16 {
+        using value_type = _word16;
+        constexpr static bool is_lock_free = true;
+
+        alignas(16) mutable _word16 word;
+
+        value_type load(std::memory_order) const noexcept {
+            _word16 expected {};
+            _cas16(&word, expected, expected);
+            return expected;
+        }
+        /// The current value, or something else if the word changed while
+        /// reading it. Only suitable as the first expected value of a
+        /// compare-and-swap loop, which costs one compare-and-swap fewer
+        /// than starting from load()
+        value_type guess() const noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return {
+                __iso_volatile_load64(&word.low),
+                __iso_volatile_load64(&word.high)};
+#else
+            auto* halves = reinterpret_cast<_word16_half const*>(&word);
+            _word16_half low = __atomic_load_n(&halves[0], __ATOMIC_RELAXED);
+            _word16_half high = __atomic_load_n(&halves[1], __ATOMIC_RELAXED);
+            _word16 value;
+            std::memcpy(&value, &low, 8);
+            std::memcpy(reinterpret_cast<unsigned char*>(&value) + 8, &high, 8);
+            return value;
+#endif
+        }
+        void store(value_type value, std::memory_order order) noexcept {
+            exchange(value, order);
+        }
+        value_type exchange(value_type value, std::memory_order) noexcept {
+            _word16 expected = guess();
+            while (!_cas16(&word, expected, value)) {
+            }
+            return expected;
+        }
+        bool compare_exchange_weak(
+            value_type& expected,
+            value_type desired,
+            std::memory_order,
+            std::memory_order) noexcept {
+            return _cas16(&word, expected, desired);
+        }
+        bool compare_exchange_strong(
+            value_type& expected,
+            value_type desired,
+            std::memory_order,
+            std::memory_order) noexcept {
+            return _cas16(&word, expected, desired);
+        }
+    };
+#else
+    struct alignas(16) _word16 {
+        uint64_t low;
+        uint64_t high;
+
+        bool operator==(_word16 const& other) const noexcept {
+            return low == other.low && high == other.high;
+        }
+    };
+
+    /// Fallback for targets without a double-width compare-and-swap: the
+    /// word is guarded by a spinlock. The critical sections are a handful of
+    /// instructions, so a spinlock beats a mutex here. Waiters yield, in
+    /// case the thread holding the lock was preempted
+    struct _atomic_word16 {
+        using value_type = _word16;
+        constexpr static bool is_lock_free = false;
+
+        _word16 word;
+        mutable std::atomic<bool> locked {false};
+
+        void lock() const noexcept {
+            while (locked.exchange(true, std::memory_order_acquire)) {
+                while (locked.load(std::memory_order_relaxed)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        void unlock() const noexcept {
+            locked.store(false, std::memory_order_release);
+        }
+
+        value_type load(std::memory_order) const noexcept {
+            lock();
+            _word16 value = word;
+            unlock();
+            return value;
+        }
+        value_type guess() const noexcept {
+            return load(std::memory_order_relaxed);
+        }
+        void store(value_type value, std::memory_order) noexcept {
+            lock();
+            word = value;
+            unlock();
+        }
+        value_type exchange(value_type value, std::memory_order) noexcept {
+            lock();
+            _word16 previous = word;
+            word = value;
+            unlock();
+            return previous;
+        }
+        bool compare_exchange_strong(
+            value_type& expected,
+            value_type desired,
+            std::memory_order,
+            std::memory_order) noexcept {
+            lock();
+            bool success = word == expected;
+            if (success) {
+                word = desired;
+            } else {
+                expected = word;
+            }
+            unlock();
+            return success;
+        }
+        bool compare_exchange_weak(
+            value_type& expected,
+            value_type desired,
+            std::memory_order success,
+            std::memory_order failure) noexcept {
+            return compare_exchange_strong(expected, desired, success, failure);
+        }
+    };
+#endif
+
+    template <size_t Size>
+    using _atomic_word_for = std::
+        conditional_t<(Size <= 8), _atomic_word8, _atomic_word16>;
+} // namespace tuplet::detail
+
+
+
+
+
+////////////////////////////////
+////  tuplet::atomic_tuple  ////
+////////////////////////////////
+
+namespace tuplet {
+    /// A tuple of trivially copyable elements that can be loaded, stored,
+    /// and compared-and-swapped atomically, as a whole. Tuples of up to 8
+    /// bytes are kept in a std::atomic<uint64_t>, and tuples of up to 16
+    /// bytes in a 16-byte word updated with a double-width compare-and-swap
+    /// (see TUPLET_HAS_DOUBLE_WIDTH_CAS).
+    ///
+    /// Values are packed into the word element by element, at the offsets
+    /// given by tuplet::layout, and padding bytes are always zero. This
+    /// means compare_exchange compares elements, rather than whatever
+    /// happened to be in the padding of the tuples involved.
+    template <class... T>
+    class atomic_tuple {
+       public:
+        using value_type = tuple<T...>;
+
+       private:
+        static_assert(
+            (std::is_trivially_copyable_v<T> && ...),
+            "atomic_tuple requires trivially copyable elements");
+        static_assert(
+            sizeof(value_type) <= 16,
+            "atomic_tuple only supports tuples of up to 16 bytes");
+        static_assert(
+            layout<value_type>::exact,
+            "atomic_tuple requires the layout of the tuple to be known");
+
+        using word_t = detail::_atomic_word_for<sizeof(value_type)>;
+        using raw_t = typename word_t::value_type;
+        using indices = std::index_sequence_for<T...>;
+
+        template <size_t I>
+        using elem_t = std::tuple_element_t<I, value_type>;
+
+       public:
+        constexpr static bool is_always_lock_free = word_t::is_lock_free;
+
+        atomic_tuple() noexcept
+          : atomic_tuple(value_type {}) {}
+        explicit atomic_tuple(value_type const& value) noexcept
+          : _word {_pack(value)} {}
+
+        atomic_tuple(atomic_tuple const&) = delete;
+        atomic_tuple& operator=(atomic_tuple const&) = delete;
+
+        value_type load(
+            std::memory_order order = std::memory_order_seq_cst) const noexcept {
+            return _unpack(_word.load(order));
+        }
+
+        void store(
+            value_type const& value,
+            std::memory_order order = std::memory_order_seq_cst) noexcept {
+            _word.store(_pack(value), order);
+        }
+
+        value_type exchange(
+            value_type const& value,
+            std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return _unpack(_word.exchange(_pack(value), order));
+        }
+
+        /// If the tuple equals expected (compared element by element, as if
+        /// by memcmp), replaces it with desired and returns true. Otherwise,
+        /// loads the current value into expected and returns false
+        bool compare_exchange_strong(
+            value_type& expected,
+            value_type const& desired,
+            std::memory_order success = std::memory_order_seq_cst,
+            std::memory_order failure = std::memory_order_seq_cst) noexcept {
+            raw_t raw = _pack(expected);
+            if (_word
+                    .compare_exchange_strong(raw, _pack(desired), success, failure)) {
+                return true;
+            }
+            expected = _unpack(raw);
+            return false;
+        }
+
+        /// Like compare_exchange_strong, but may fail spuriously
+        bool compare_exchange_weak(
+            value_type& expected,
+            value_type const& desired,
+            std::memory_order success = std::memory_order_seq_cst,
+            std::memory_order failure = std::memory_order_seq_cst) noexcept {
+            raw_t raw = _pack(expected);
+            if (_word
+                    .compare_exchange_weak(raw, _pack(desired), success, failure)) {
+                return true;
+            }
+            expected = _unpack(raw);
+            return false;
+        }
+
+        /// Atomically adds arg to element I, leaving the other elements
+        /// unchanged, and returns the previous value of element I. This is
+        /// a compare-and-swap loop over the whole word, which only reads
+        /// and writes the bytes of element I on each attempt
+        template <size_t I, class U>
+        elem_t<I> fetch_add(
+            U const& arg,
+            std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return fetch_update<I>(
+                [&](elem_t<I> const& value) { return value + arg; },
+                order);
+        }
+
+        /// Atomically subtracts arg from element I, and returns the previous
+        /// value of element I
+        template <size_t I, class U>
+        elem_t<I> fetch_sub(
+            U const& arg,
+            std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return fetch_update<I>(
+                [&](elem_t<I> const& value) { return value - arg; },
+                order);
+        }
+
+        /// Atomically replaces element I with func(element I), and returns
+        /// the previous value of element I. func may be called more than
+        /// once if other threads modify the tuple concurrently
+        template <size_t I, class F>
+        elem_t<I> fetch_update(
+            F&& func,
+            std::memory_order order = std::memory_order_seq_cst) {
+            raw_t raw = _word.guess();
+            for (;;) {
+                elem_t<I> previous = _read<I>(raw);
+                raw_t desired = raw;
+                _write<I>(desired, static_cast<elem_t<I>>(func(previous)));
+                if (_word.compare_exchange_weak(
+                        raw,
+                        desired,
+                        order,
+                        std::memory_order_relaxed)) {
+                    return previous;
+                }
+            }
+        }
+
+       private:
+        constexpr static size_t _offset(size_t i) {
+            return layout<value_type>::offsets[i];
+        }
+
+        template <size_t I>
+        static elem_t<I> _read(raw_t const& raw) noexcept {
+            alignas(elem_t<I>) unsigned char bytes[sizeof(elem_t<I>)];
+            std::memcpy(
+                bytes,
+                reinterpret_cast<unsigned char const*>(&raw) + _offset(I),
+                sizeof(elem_t<I>));
+            return *std::launder(reinterpret_cast<elem_t<I>*>(bytes));
+        }
+
+        template <size_t I>
+        static void _write(raw_t& raw, elem_t<I> const& value) noexcept {
+            if constexpr (!std::is_empty_v<elem_t<I>>) {
+                std::memcpy(
+                    reinterpret_cast<unsigned char*>(&raw) + _offset(I),
+                    &value,
+                    sizeof(elem_t<I>));
+            }
+        }
+
+        template <size_t... I>
+        static raw_t _pack(
+            value_type const& value,
+            std::index_sequence<I...>) noexcept {
+            raw_t raw {};
+            (_write<I>(raw, tuplet::get<I>(value)), ...);
+            return raw;
+        }
+        static raw_t _pack(value_type const& value) noexcept {
+            return _pack(value, indices {});
+        }
+
+        /// Elements are stored at the same offsets as in the tuple, so the
+        /// word can be copied into a tuple as is
+        static value_type _unpack(raw_t const& raw) noexcept {
+            alignas(value_type) unsigned char bytes[sizeof(value_type)];
+            std::memcpy(bytes, &raw, sizeof(value_type));
+            return *std::launder(reinterpret_cast<value_type*>(bytes));
+        }
+
+        word_t _word;
+    };
+} // namespace tuplet
+#endif
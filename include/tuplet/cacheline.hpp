@@ -0,0 +1,215 @@
+#ifndef TUPLET_CACHELINE_HPP_IMPLEMENTATION
+#define TUPLET_CACHELINE_HPP_IMPLEMENTATION
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <tuple>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+/**
+ * tuplet::cache_line_size is the distance two objects must be apart to
+ * avoid false sharing. It's TUPLET_CACHE_LINE_SIZE if that's defined, and
+ * std::hardware_destructive_interference_size where the standard library
+ * provides it. Otherwise it's 64, which is right for x86-64 and most ARM
+ * cores (Apple's are 128, so define TUPLET_CACHE_LINE_SIZE there if the
+ * standard library doesn't know better).
+ *
+ * The value is baked into the layout of every type using it, so it must be
+ * the same across all translation units that share those types.
+ */
+namespace tuplet {
+#if defined(TUPLET_CACHE_LINE_SIZE)
+    constexpr size_t cache_line_size = TUPLET_CACHE_LINE_SIZE;
+#elif __cpp_lib_hardware_interference_size
+// GCC warns that the value depends on -mtune, which is the caveat above
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 12
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+    constexpr size_t cache_line_size = std::
+        hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 12
+#pragma GCC diagnostic pop
+#endif
+#else
+    constexpr size_t cache_line_size = 64;
+#endif
+} // namespace tuplet
+
+
+
+
+
+///////////////////////////////////////////////
+////  tuplet::detail: Cache Line Elements  ////
+///////////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// An element on its own cache line(s). Aligning the element also pads
+    /// its size to a multiple of the alignment, so nothing else can share
+    /// its last cache line either
+    template <class T>
+    struct alignas(cache_line_size) _cacheline_elem {
+        T value;
+    };
+
+    /// Snapshots hold the values of atomics, rather than the atomics
+    template <class T>
+    struct _snapshot_elem {
+        using type = T;
+        static T const& get(T const& value) noexcept { return value; }
+    };
+    template <class T>
+    struct _snapshot_elem<std::atomic<T>> {
+        using type = T;
+        static T get(std::atomic<T> const& value) noexcept {
+            return value.load(std::memory_order_relaxed);
+        }
+    };
+
+    /// True when the arguments are a single Self, which should go to the
+    /// copy or move constructor, rather than initialize an element
+    template <class Self, class... U>
+    constexpr bool _is_self_arg = false;
+    template <class Self, class U>
+    constexpr bool _is_self_arg<Self, U> =
+        std::is_same_v<std::decay_t<U>, Self>;
+} // namespace tuplet::detail
+
+
+
+
+
+///////////////////////////////////
+////  tuplet::cacheline_tuple  ////
+///////////////////////////////////
+
+namespace tuplet {
+    /// A tuple where each element is aligned and padded to cache_line_size,
+    /// so that threads writing to different elements don't contend for the
+    /// same cache line. This is meant for things like a set of per-subsystem
+    /// counters, which are hot and written from different threads.
+    ///
+    /// Elements are accessed the same way as in a tuplet::tuple (with
+    /// tuplet::get, tags, structured bindings, for_each and apply), and
+    /// snapshot() copies the elements into a dense tuplet::tuple.
+    template <class... T>
+    class cacheline_tuple {
+        using elems_t = tuple<detail::_cacheline_elem<T>...>;
+
+       public:
+        /// The dense tuple returned by snapshot(). std::atomic<U> elements
+        /// become U
+        using snapshot_type = tuple<typename detail::_snapshot_elem<T>::type...>;
+
+        /// Value-initializes each element
+        constexpr cacheline_tuple()
+          : _elems {} {}
+
+        /// Initializes each element from the corresponding argument. Since
+        /// elements are initialized in place, they don't need to be movable
+        /// (so std::atomic works)
+        template <
+            class... U,
+            class = std::enable_if_t<
+                sizeof...(U) == sizeof...(T) && sizeof...(U) != 0
+                && !detail::_is_self_arg<cacheline_tuple, U...>>>
+        constexpr explicit cacheline_tuple(U&&... args)
+          : _elems {detail::_cacheline_elem<T> {static_cast<U&&>(args)}...} {}
+
+        template <size_t I>
+        constexpr decltype(auto) operator[](tag<I>) & noexcept {
+            return (_elems[tag<I>()].value);
+        }
+        template <size_t I>
+        constexpr decltype(auto) operator[](tag<I>) const& noexcept {
+            return (_elems[tag<I>()].value);
+        }
+        template <size_t I>
+        constexpr decltype(auto) operator[](tag<I>) && noexcept {
+            return static_cast<
+                std::tuple_element_t<I, tuple<T...>>&&>(
+                _elems[tag<I>()].value);
+        }
+
+        template <class F>
+        constexpr void for_each(F&& func) & {
+            _elems.for_each([&](auto& elem) { func(elem.value); });
+        }
+        template <class F>
+        constexpr void for_each(F&& func) const& {
+            _elems.for_each([&](auto const& elem) { func(elem.value); });
+        }
+        template <class F>
+        constexpr void for_each(F&& func) && {
+            static_cast<elems_t&&>(_elems).for_each([&](auto&& elem) {
+                func(static_cast<decltype(elem)&&>(elem).value);
+            });
+        }
+
+        template <class F>
+        constexpr decltype(auto) apply(F&& func) & {
+            return _elems.apply([&](auto&... elems) -> decltype(auto) {
+                return static_cast<F&&>(func)(elems.value...);
+            });
+        }
+        template <class F>
+        constexpr decltype(auto) apply(F&& func) const& {
+            return _elems.apply([&](auto const&... elems) -> decltype(auto) {
+                return static_cast<F&&>(func)(elems.value...);
+            });
+        }
+        template <class F>
+        constexpr decltype(auto) apply(F&& func) && {
+            return static_cast<elems_t&&>(_elems).apply(
+                [&](auto&&... elems) -> decltype(auto) {
+                    return static_cast<F&&>(func)(
+                        static_cast<decltype(elems)&&>(elems).value...);
+                });
+        }
+
+        /// Copies every element into a dense tuple. Atomics are loaded
+        /// with relaxed ordering, one at a time, so the snapshot is not
+        /// taken at a single point in time
+        snapshot_type snapshot() const {
+            return _elems.apply([](auto const&... elems) {
+                return snapshot_type {detail::_snapshot_elem<T>::get(
+                    elems.value)...};
+            });
+        }
+
+       private:
+        elems_t _elems;
+    };
+
+    template <class F, class... T>
+    constexpr decltype(auto) apply(F&& func, cacheline_tuple<T...>& tup) {
+        return tup.apply(static_cast<F&&>(func));
+    }
+    template <class F, class... T>
+    constexpr decltype(auto) apply(
+        F&& func,
+        cacheline_tuple<T...> const& tup) {
+        return tup.apply(static_cast<F&&>(func));
+    }
+    template <class F, class... T>
+    constexpr decltype(auto) apply(F&& func, cacheline_tuple<T...>&& tup) {
+        return static_cast<cacheline_tuple<T...>&&>(tup).apply(
+            static_cast<F&&>(func));
+    }
+} // namespace tuplet
+
+namespace std {
+    template <class... T>
+    struct tuple_size<tuplet::cacheline_tuple<T...>>
+      : std::integral_constant<size_t, sizeof...(T)> {};
+
+    template <size_t I, class... T>
+    struct tuple_element<I, tuplet::cacheline_tuple<T...>> {
+        using type = std::tuple_element_t<I, tuplet::tuple<T...>>;
+    };
+} // namespace std
+#endif
@@ -0,0 +1,136 @@
+#ifndef TUPLET_COUNTING_HPP_IMPLEMENTATION
+#define TUPLET_COUNTING_HPP_IMPLEMENTATION
+
+#include <cstddef>
+#include <tuplet/tuple.hpp>
+#include <utility>
+
+/**
+ * When TUPLET_TRACE_COPIES is 1, tuplet::counting<T> records every copy, move,
+ * and destruction of the wrapper, and tuplet::count_copies reports how many of
+ * each happened while running a function.
+ *
+ * When TUPLET_TRACE_COPIES is 0 (the default), tuplet::counting<T> is just a
+ * wrapper around T. It stays trivially copyable whenever T is, so it can be
+ * left in production types at no cost.
+ */
+#if !defined(TUPLET_TRACE_COPIES)
+#define TUPLET_TRACE_COPIES 0
+#endif
+
+
+
+
+
+//////////////////////////////////////
+////  tuplet::copy_counts Struct  ////
+//////////////////////////////////////
+
+namespace tuplet {
+    /// Number of copies, moves, and destructions performed on
+    /// tuplet::counting values. Copy and move assignments are counted as
+    /// copies and moves respectively
+    struct copy_counts {
+        size_t copies = 0;
+        size_t moves = 0;
+        size_t destructions = 0;
+
+        constexpr copy_counts operator-(copy_counts const& other) const {
+            return {
+                copies - other.copies,
+                moves - other.moves,
+                destructions - other.destructions};
+        }
+        constexpr bool operator==(copy_counts const& other) const {
+            return copies == other.copies && moves == other.moves
+                && destructions == other.destructions;
+        }
+        constexpr bool operator!=(copy_counts const& other) const {
+            return !(*this == other);
+        }
+    };
+} // namespace tuplet
+
+
+
+
+
+////////////////////////////////////////
+////  tuplet::detail::_copy_tracer  ////
+////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// Per-thread counters, so that tests running in parallel don't see each
+    /// other's copies
+    inline copy_counts& _copy_counts() noexcept {
+        thread_local copy_counts counts;
+        return counts;
+    }
+
+    /// Empty base class of tuplet::counting. When tracing is disabled, it's
+    /// trivial, and so it doesn't affect the triviality of tuplet::counting
+    template <bool Trace>
+    struct _copy_tracer {};
+
+    template <>
+    struct _copy_tracer<true> {
+        _copy_tracer() = default;
+        _copy_tracer(_copy_tracer const&) noexcept {
+            ++_copy_counts().copies;
+        }
+        _copy_tracer(_copy_tracer&&) noexcept { ++_copy_counts().moves; }
+        _copy_tracer& operator=(_copy_tracer const&) noexcept {
+            ++_copy_counts().copies;
+            return *this;
+        }
+        _copy_tracer& operator=(_copy_tracer&&) noexcept {
+            ++_copy_counts().moves;
+            return *this;
+        }
+        ~_copy_tracer() { ++_copy_counts().destructions; }
+    };
+} // namespace tuplet::detail
+
+
+
+
+
+/////////////////////////////////////////////////////
+////  tuplet::counting and tuplet::count_copies  ////
+/////////////////////////////////////////////////////
+
+namespace tuplet {
+    /// Wraps a value of type T, counting copies, moves, and destructions of
+    /// the wrapper when TUPLET_TRACE_COPIES is enabled. Constructing a
+    /// counting<T> from a T is not counted.
+    template <class T>
+    struct counting : private detail::_copy_tracer<bool(TUPLET_TRACE_COPIES)> {
+        T value;
+
+        counting() = default;
+        constexpr counting(T const& value) : value(value) {}
+        constexpr counting(T&& value) : value(static_cast<T&&>(value)) {}
+
+        constexpr bool operator==(counting const& other) const {
+            return value == other.value;
+        }
+        constexpr bool operator!=(counting const& other) const {
+            return !(value == other.value);
+        }
+    };
+
+    /// Returns the copy counts recorded on this thread so far
+    inline copy_counts current_copy_counts() noexcept {
+        return detail::_copy_counts();
+    }
+
+    /// Invokes func, and returns the number of copies, moves, and
+    /// destructions of tuplet::counting values that happened during the call
+    template <class F>
+    copy_counts count_copies(F&& func) {
+        copy_counts before = current_copy_counts();
+        static_cast<F&&>(func)();
+        return current_copy_counts() - before;
+    }
+} // namespace tuplet
+#endif
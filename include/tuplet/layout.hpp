@@ -0,0 +1,188 @@
+#ifndef TUPLET_LAYOUT_HPP_IMPLEMENTATION
+#define TUPLET_LAYOUT_HPP_IMPLEMENTATION
+
+#include <array>
+#include <cstddef>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+
+
+
+
+
+//////////////////////////////////////////////
+////  tuplet::detail: Layout Computation  ////
+//////////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// Storage used by element I of a tuple. Empty elements take up no space
+    /// when the tuple_elem holding them is itself empty (which is the case
+    /// when [[no_unique_address]] is available)
+    template <size_t I, class T>
+    constexpr size_t _elem_size = std::is_empty_v<tuple_elem<I, T>>
+                                    ? 0
+                                    : sizeof(tuple_elem<I, T>);
+
+    template <size_t I, class T>
+    constexpr size_t _elem_align = alignof(tuple_elem<I, T>);
+
+    constexpr size_t _align_up(size_t offset, size_t align) {
+        return (offset + align - 1) / align * align;
+    }
+
+    template <size_t N>
+    struct _layout_info {
+        std::array<size_t, N> offsets {};
+        size_t size = 0;
+        size_t align = 1;
+    };
+
+    /// Places each element at the first suitably aligned offset after the
+    /// previous element, visiting elements in the given order
+    template <size_t N>
+    constexpr _layout_info<N> _compute_layout(
+        std::array<size_t, N> const& sizes,
+        std::array<size_t, N> const& aligns,
+        std::array<size_t, N> const& order) {
+        _layout_info<N> info;
+        size_t offset = 0;
+        for (size_t i = 0; i < N; i++) {
+            size_t elem = order[i];
+            if (sizes[elem] == 0) {
+                // Empty elements don't occupy any storage
+                info.offsets[elem] = 0;
+                continue;
+            }
+            offset = _align_up(offset, aligns[elem]);
+            info.offsets[elem] = offset;
+            offset += sizes[elem];
+            if (aligns[elem] > info.align) {
+                info.align = aligns[elem];
+            }
+        }
+        info.size = _align_up(offset, info.align);
+        // Like any other class, a tuple with no storage still has size 1
+        if (info.size == 0) {
+            info.size = 1;
+        }
+        return info;
+    }
+
+    template <size_t N>
+    constexpr std::array<size_t, N> _declaration_order() {
+        std::array<size_t, N> order {};
+        for (size_t i = 0; i < N; i++) {
+            order[i] = i;
+        }
+        return order;
+    }
+
+    /// Sorts element indices by decreasing alignment. The sort is stable, so
+    /// elements with the same alignment keep their declaration order
+    template <size_t N>
+    constexpr std::array<size_t, N> _order_by_alignment(
+        std::array<size_t, N> const& aligns) {
+        std::array<size_t, N> order = _declaration_order<N>();
+        // Insertion sort: N is small, and this has to run at compile time
+        for (size_t i = 1; i < N; i++) {
+            size_t elem = order[i];
+            size_t j = i;
+            for (; j > 0 && aligns[order[j - 1]] < aligns[elem]; j--) {
+                order[j] = order[j - 1];
+            }
+            order[j] = elem;
+        }
+        return order;
+    }
+
+    template <class... T, size_t... I>
+    constexpr auto _elem_sizes(std::index_sequence<I...>) {
+        return std::array<size_t, sizeof...(T)> {_elem_size<I, T>...};
+    }
+    template <class... T, size_t... I>
+    constexpr auto _elem_aligns(std::index_sequence<I...>) {
+        return std::array<size_t, sizeof...(T)> {_elem_align<I, T>...};
+    }
+} // namespace tuplet::detail
+
+
+
+
+
+/////////////////////////////////
+////  tuplet::layout<Tuple>  ////
+/////////////////////////////////
+
+namespace tuplet {
+    /// Compile-time description of where the elements of a tuple live.
+    ///
+    /// Offsets are computed by placing each element at the next suitably
+    /// aligned offset, which is what the Itanium and MSVC ABIs do for tuples
+    /// of trivially copyable, non-empty types. The ABI may pack elements
+    /// more tightly than that in some cases (e.g, by reusing the tail padding
+    /// of non-POD elements marked [[no_unique_address]]); layout::exact is
+    /// false when the computed size disagrees with sizeof(Tuple).
+    template <class Tuple>
+    struct layout;
+
+    template <class... T>
+    struct layout<tuple<T...>> {
+       private:
+        using indices = std::index_sequence_for<T...>;
+        constexpr static std::array<size_t, sizeof...(T)>
+            _sizes = detail::_elem_sizes<T...>(indices {});
+        constexpr static std::array<size_t, sizeof...(T)>
+            _aligns = detail::_elem_aligns<T...>(indices {});
+        constexpr static auto _computed = detail::_compute_layout(
+            _sizes,
+            _aligns,
+            detail::_declaration_order<sizeof...(T)>());
+
+        constexpr static size_t _total_elem_size() {
+            size_t total = 0;
+            for (size_t size : _sizes) {
+                total += size;
+            }
+            return total;
+        }
+
+       public:
+        constexpr static size_t N = sizeof...(T);
+        constexpr static size_t size = sizeof(tuple<T...>);
+        constexpr static size_t align = alignof(tuple<T...>);
+
+        /// Offset of each element, in declaration order
+        constexpr static std::array<size_t, N> offsets = _computed.offsets;
+
+        /// Offset of element I from the start of the tuple
+        template <size_t I>
+        constexpr static size_t offset_of = offsets[I];
+
+        /// True if the computed layout has the same size as the tuple
+        constexpr static bool exact = _computed.size == size;
+
+        /// Bytes in the tuple not used by any element, including tail padding
+        constexpr static size_t padding = size - _total_elem_size();
+
+        /// Order of elements that minimizes padding: element
+        /// optimal_order[0] goes first, then element optimal_order[1], and
+        /// so on. Elements are sorted by decreasing alignment, keeping the
+        /// declaration order for elements with the same alignment
+        constexpr static std::array<size_t, N>
+            optimal_order = detail::_order_by_alignment(_aligns);
+
+        /// Size of the tuple when elements are reordered by optimal_order
+        constexpr static size_t optimal_size =
+            detail::_compute_layout(_sizes, _aligns, optimal_order).size;
+
+        /// Padding of the tuple when elements are reordered by optimal_order
+        constexpr static size_t optimal_padding = optimal_size
+                                                - _total_elem_size();
+    };
+
+    /// True if a tuple has at most Bytes bytes of padding. Intended for use
+    /// in static_assert, to enforce memory budgets on hot types
+    template <class Tuple, size_t Bytes>
+    constexpr bool max_padding_v = layout<Tuple>::padding <= Bytes;
+} // namespace tuplet
+#endif
@@ -0,0 +1,88 @@
+#ifndef TUPLET_PROJECT_HPP_IMPLEMENTATION
+#define TUPLET_PROJECT_HPP_IMPLEMENTATION
+
+#include <cstddef>
+#include <functional>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+
+/**
+ * tuplet::project<I...>(func) adapts a comparator or hasher on tuples so
+ * that it only looks at elements I... of each argument. Those elements are
+ * viewed with tuplet::tie_select, so nothing is copied:
+ *
+ *     std::sort(rows.begin(), rows.end(), tuplet::project<3, 0>());
+ *     std::unordered_set<row,
+ *         tuplet::projection<tuplet::tuple_hash, 3, 0>,
+ *         tuplet::projection<std::equal_to<>, 3, 0>> by_key;
+ */
+
+
+
+
+
+//////////////////////////////
+////  tuplet::tuple_hash  ////
+//////////////////////////////
+
+namespace tuplet::detail {
+    /// Mixes h into seed, as in boost::hash_combine
+    constexpr size_t _hash_combine(size_t seed, size_t h) noexcept {
+        return seed ^ (h + size_t(0x9e3779b97f4a7c15) + (seed << 6)
+                       + (seed >> 2));
+    }
+} // namespace tuplet::detail
+
+namespace tuplet {
+    /// Hashes a tuple by combining std::hash of each of its elements, in
+    /// order. Tuples of references hash the same as tuples of the values
+    /// they refer to, so hashing a tie_select view hashes part of a tuple
+    struct tuple_hash {
+        template <class... T>
+        size_t operator()(tuple<T...> const& tup) const {
+            return tuplet::apply(
+                [](auto const&... elems) {
+                    size_t seed = 0;
+                    ((seed = detail::_hash_combine(
+                          seed,
+                          std::hash<std::decay_t<decltype(elems)>>()(elems))),
+                     ...);
+                    return seed;
+                },
+                tup);
+        }
+    };
+} // namespace tuplet
+
+
+
+
+
+///////////////////////////////////////////////
+////  tuplet::projection, tuplet::project  ////
+///////////////////////////////////////////////
+
+namespace tuplet {
+    /// A function object that calls func with tie_select<I...>(arg) for
+    /// each of its arguments. With one argument it's a hasher, and with two
+    /// it's a comparator
+    template <class F, size_t... I>
+    struct projection {
+        TUPLET_NO_UNIQUE_ADDRESS F func;
+
+        template <class... Tup>
+        TUPLET_INLINE constexpr auto operator()(Tup const&... tups) const
+            -> decltype(func(tuplet::tie_select<I...>(tups)...)) {
+            return func(tuplet::tie_select<I...>(tups)...);
+        }
+    };
+
+    /// Returns a projection of func onto elements I... (see projection).
+    /// By default, it compares elements I... with <, so it can be passed
+    /// straight to std::sort
+    template <size_t... I, class F = std::less<>>
+    TUPLET_INLINE constexpr projection<F, I...> project(F func = {}) {
+        return {static_cast<F&&>(func)};
+    }
+} // namespace tuplet
+#endif
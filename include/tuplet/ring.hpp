@@ -0,0 +1,313 @@
+#ifndef TUPLET_RING_HPP_IMPLEMENTATION
+#define TUPLET_RING_HPP_IMPLEMENTATION
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <tuplet/cacheline.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+
+
+
+
+
+////////////////////////////////////////
+////  tuplet::detail: Ring Details  ////
+////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// Smallest power of two that's at least n (and at least 2)
+    constexpr size_t _ring_capacity(size_t n) {
+        size_t capacity = 2;
+        while (capacity < n) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    /// Raw storage for one value. Values are trivially copyable, so they're
+    /// copied in and out with memcpy, and slots never need constructing
+    template <class T>
+    struct _ring_slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    /// An index written by one side of a ring, on a cache line of its own
+    struct alignas(cache_line_size) _ring_index {
+        std::atomic<size_t> value {0};
+    };
+
+    /// An index written by one side of a ring, along with that side's last
+    /// known value of the other side's index, on a cache line of their own
+    struct alignas(cache_line_size) _ring_cursor {
+        std::atomic<size_t> value {0};
+        size_t cached_other = 0;
+    };
+
+    template <class T>
+    void _ring_store(T const& value, _ring_slot<T>& slot) noexcept {
+        std::memcpy(slot.bytes, &value, sizeof(T));
+    }
+    template <class T>
+    void _ring_load(_ring_slot<T> const& slot, T& value) noexcept {
+        std::memcpy(&value, slot.bytes, sizeof(T));
+    }
+
+    template <class T>
+    void _check_ring_value() {
+        static_assert(
+            std::is_trivially_copyable_v<T>,
+            "Ring buffers copy values with memcpy, so they must be "
+            "trivially copyable");
+    }
+} // namespace tuplet::detail
+
+
+
+
+
+////////////////////////////////
+////  tuplet::spsc_ring<T>  ////
+////////////////////////////////
+
+namespace tuplet {
+    /// Fixed-capacity queue with one producer thread and one consumer
+    /// thread. Values are copied into and out of a preallocated buffer with
+    /// memcpy, so pushing and popping never allocate.
+    ///
+    /// The producer's and consumer's indices live on separate cache lines,
+    /// and each side caches the other's index, so it only reads the other
+    /// side's cache line when the ring looks full (or empty). push_n and
+    /// pop_n move a batch of values with a single atomic store.
+    template <class T>
+    class spsc_ring {
+        using slot_t = detail::_ring_slot<T>;
+
+       public:
+        using value_type = T;
+
+        /// Capacity is rounded up to a power of two
+        explicit spsc_ring(size_t capacity)
+          : _mask(detail::_ring_capacity(capacity) - 1)
+          , _slots(new slot_t[_mask + 1]) {
+            detail::_check_ring_value<T>();
+        }
+
+        spsc_ring(spsc_ring const&) = delete;
+        spsc_ring& operator=(spsc_ring const&) = delete;
+
+        size_t capacity() const noexcept { return _mask + 1; }
+
+        /// Pushes a value, unless the ring is full. Producer only
+        bool try_push(T const& value) noexcept {
+            return push_n(&value, 1) == 1;
+        }
+
+        /// Pops a value into out, unless the ring is empty. Consumer only
+        bool try_pop(T& out) noexcept { return pop_n(&out, 1) == 1; }
+
+        /// Pushes up to count values, as many as fit, and returns how many
+        /// were pushed. Producer only
+        size_t push_n(T const* values, size_t count) noexcept {
+            size_t head = _head.value.load(std::memory_order_relaxed);
+            size_t space = capacity() - (head - _head.cached_other);
+            if (space < count) {
+                _head.cached_other = _tail.value.load(
+                    std::memory_order_acquire);
+                space = capacity() - (head - _head.cached_other);
+            }
+            count = count < space ? count : space;
+            _copy_in(head, values, count);
+            _head.value.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        /// Pops up to count values into out, and returns how many were
+        /// popped. Consumer only
+        size_t pop_n(T* out, size_t count) noexcept {
+            size_t tail = _tail.value.load(std::memory_order_relaxed);
+            size_t available = _tail.cached_other - tail;
+            if (available < count) {
+                _tail.cached_other = _head.value.load(
+                    std::memory_order_acquire);
+                available = _tail.cached_other - tail;
+            }
+            count = count < available ? count : available;
+            _copy_out(tail, out, count);
+            _tail.value.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+       private:
+        /// Copies values into the slots starting at index, in at most two
+        /// pieces (before and after the end of the buffer)
+        void _copy_in(size_t index, T const* values, size_t count) noexcept {
+            size_t start = index & _mask;
+            size_t first = count < capacity() - start ? count
+                                                      : capacity() - start;
+            std::memcpy(_slots[start].bytes, values, first * sizeof(T));
+            std::memcpy(
+                _slots[0].bytes,
+                values + first,
+                (count - first) * sizeof(T));
+        }
+
+        void _copy_out(size_t index, T* out, size_t count) noexcept {
+            size_t start = index & _mask;
+            size_t first = count < capacity() - start ? count
+                                                      : capacity() - start;
+            std::memcpy(out, _slots[start].bytes, first * sizeof(T));
+            std::memcpy(
+                out + first,
+                _slots[0].bytes,
+                (count - first) * sizeof(T));
+        }
+
+        /// Written by the producer
+        detail::_ring_cursor _head;
+        /// Written by the consumer
+        detail::_ring_cursor _tail;
+        size_t const _mask;
+        std::unique_ptr<slot_t[]> const _slots;
+    };
+} // namespace tuplet
+
+
+
+
+
+////////////////////////////////
+////  tuplet::mpmc_ring<T>  ////
+////////////////////////////////
+
+namespace tuplet::detail {
+    /// A slot of an mpmc_ring, with a sequence number saying whose turn it
+    /// is: seq == i means the slot is free for the producer pushing the
+    /// i-th value, and seq == i + 1 means it holds the i-th value, ready for
+    /// a consumer
+    template <class T>
+    struct _mpmc_cell {
+        std::atomic<size_t> seq;
+        _ring_slot<T> slot;
+    };
+} // namespace tuplet::detail
+
+namespace tuplet {
+    /// Fixed-capacity queue with any number of producers and consumers,
+    /// using Dmitry Vyukov's bounded queue algorithm. Producers claim slots
+    /// by advancing a shared index with a compare-and-swap, and each slot
+    /// has a sequence number that hands it from producer to consumer and
+    /// back, so producers and consumers never wait on each other unless the
+    /// ring is full or empty.
+    ///
+    /// push_n and pop_n claim a run of consecutive slots with a single
+    /// compare-and-swap, which is where the contention is.
+    template <class T>
+    class mpmc_ring {
+        using cell_t = detail::_mpmc_cell<T>;
+
+       public:
+        using value_type = T;
+
+        /// Capacity is rounded up to a power of two
+        explicit mpmc_ring(size_t capacity)
+          : _mask(detail::_ring_capacity(capacity) - 1)
+          , _cells(new cell_t[_mask + 1]) {
+            detail::_check_ring_value<T>();
+            for (size_t i = 0; i <= _mask; i++) {
+                _cells[i].seq.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        mpmc_ring(mpmc_ring const&) = delete;
+        mpmc_ring& operator=(mpmc_ring const&) = delete;
+
+        size_t capacity() const noexcept { return _mask + 1; }
+
+        bool try_push(T const& value) noexcept {
+            return push_n(&value, 1) == 1;
+        }
+
+        bool try_pop(T& out) noexcept { return pop_n(&out, 1) == 1; }
+
+        /// Pushes up to count values, as many consecutive slots as are free,
+        /// and returns how many were pushed
+        size_t push_n(T const* values, size_t count) noexcept {
+            size_t start = _head.value.load(std::memory_order_relaxed);
+            size_t claimed = _claim(_head, start, count, 0);
+            for (size_t i = 0; i < claimed; i++) {
+                cell_t& cell = _cells[(start + i) & _mask];
+                detail::_ring_store(values[i], cell.slot);
+                cell.seq.store(start + i + 1, std::memory_order_release);
+            }
+            return claimed;
+        }
+
+        /// Pops up to count values into out, as many consecutive values as
+        /// are ready, and returns how many were popped
+        size_t pop_n(T* out, size_t count) noexcept {
+            size_t start = _tail.value.load(std::memory_order_relaxed);
+            size_t claimed = _claim(_tail, start, count, 1);
+            for (size_t i = 0; i < claimed; i++) {
+                cell_t& cell = _cells[(start + i) & _mask];
+                detail::_ring_load(cell.slot, out[i]);
+                // Free for the producer one lap later
+                cell.seq.store(
+                    start + i + capacity(),
+                    std::memory_order_release);
+            }
+            return claimed;
+        }
+
+       private:
+        /// Advances index past up to count consecutive slots whose sequence
+        /// number is (their position + lag), and returns how many were
+        /// claimed. start is updated to the first claimed position
+        size_t _claim(
+            detail::_ring_index& index,
+            size_t& start,
+            size_t count,
+            size_t lag) noexcept {
+            for (;;) {
+                size_t ready = 0;
+                bool behind = false;
+                for (; ready < count; ready++) {
+                    size_t pos = start + ready;
+                    size_t seq = _cells[pos & _mask].seq.load(
+                        std::memory_order_acquire);
+                    if (seq != pos + lag) {
+                        // A sequence number ahead of pos means another
+                        // thread already claimed it, and start is stale
+                        behind = ready == 0
+                              && ptrdiff_t(seq - (pos + lag)) > 0;
+                        break;
+                    }
+                }
+                if (ready == 0 && !behind) {
+                    return 0;
+                }
+                if (ready != 0
+                    && index.value.compare_exchange_weak(
+                        start,
+                        start + ready,
+                        std::memory_order_relaxed,
+                        std::memory_order_relaxed)) {
+                    return ready;
+                }
+                if (behind) {
+                    start = index.value.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// Next position to push to
+        detail::_ring_index _head;
+        /// Next position to pop from
+        detail::_ring_index _tail;
+        size_t const _mask;
+        std::unique_ptr<cell_t[]> const _cells;
+    };
+} // namespace tuplet
+#endif
@@ -0,0 +1,133 @@
+#ifndef TUPLET_RUNTIME_INDEX_HPP_IMPLEMENTATION
+#define TUPLET_RUNTIME_INDEX_HPP_IMPLEMENTATION
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<span>) && (__cplusplus > 201703L || _MSVC_LANG > 201703L)
+#include <span>
+#endif
+
+/**
+ * Checked access to the elements of a tuple by an index that's only known
+ * at run time. tuple[i] and tuple.data() are in tuplet/tuple.hpp; what's
+ * here needs <stdexcept> (or <span>), so it's kept out of tuple.hpp:
+ *
+ *     tuplet::at(tup, i)            // tup[i], but throws std::out_of_range
+ *     tuplet::as_span(tup)          // std::span<T, N> over tup (C++20)
+ *     tuplet::visit_at(tup, i, f)   // f(element i), for any tuple
+ */
+
+
+
+
+
+///////////////////////////////////////
+////  tuplet::at, tuplet::as_span  ////
+///////////////////////////////////////
+
+namespace tuplet {
+    /// Like tup[i], for tuples laid out like an array (see tuple::data), but
+    /// throws std::out_of_range if i >= N
+    template <class... T>
+    TUPLET_INLINE auto& at(tuple<T...>& tup, size_t i) {
+        if (i >= sizeof...(T)) {
+            throw std::out_of_range("tuplet::at");
+        }
+        return tup.data()[i];
+    }
+    template <class... T>
+    TUPLET_INLINE auto& at(tuple<T...> const& tup, size_t i) {
+        if (i >= sizeof...(T)) {
+            throw std::out_of_range("tuplet::at");
+        }
+        return tup.data()[i];
+    }
+
+#if __cpp_lib_span
+    /// The elements of a tuple laid out like an array (see tuple::data), as
+    /// a std::span of fixed size
+    template <class... T>
+    TUPLET_INLINE constexpr auto as_span(tuple<T...>& tup) noexcept {
+        using elem_t = std::remove_pointer_t<decltype(tup.data())>;
+        return std::span<elem_t, sizeof...(T)>(tup.data(), sizeof...(T));
+    }
+    template <class... T>
+    TUPLET_INLINE constexpr auto as_span(tuple<T...> const& tup) noexcept {
+        using elem_t = std::remove_pointer_t<decltype(tup.data())>;
+        return std::span<elem_t, sizeof...(T)>(tup.data(), sizeof...(T));
+    }
+#endif
+} // namespace tuplet
+
+
+
+
+
+////////////////////////////
+////  tuplet::visit_at  ////
+////////////////////////////
+
+namespace tuplet::detail {
+    /// Calls func on the element of tup stored in base B. Each entry in the
+    /// table used by visit_at is one of these
+    template <class R, class Tup, class F, class B>
+    constexpr R _visit_elem(Tup&& tup, F&& func) {
+        return static_cast<F&&>(func)(TUPLET_FWD_M(Tup, B, tup, value));
+    }
+
+    template <class R, class Tup, class F>
+    using _visit_fn = R (*)(Tup&&, F&&);
+
+    /// One function per element, so visit_at is a single indirect call,
+    /// however many elements there are
+    template <class R, class Tup, class F, class... B>
+    constexpr _visit_fn<R, Tup, F> _visit_table[] {
+        &_visit_elem<R, Tup, F, B>...};
+
+    template <class Tup, class F, class B>
+    using _visit_result_t = decltype(std::declval<F>()(
+        static_cast<forward_as_t<Tup&&, B>>(std::declval<Tup&>()).value));
+
+    template <class Tup, class F, class B0, class... B>
+    TUPLET_INLINE constexpr decltype(auto) _visit_at(
+        Tup&& tup,
+        size_t i,
+        F&& func,
+        type_list<B0, B...>) {
+        using R = _visit_result_t<Tup, F, B0>;
+        static_assert(
+            (std::is_same_v<R, _visit_result_t<Tup, F, B>> && ...),
+            "tuplet::visit_at requires func to return the same type for "
+            "every element");
+        if (i > sizeof...(B)) {
+            throw std::out_of_range("tuplet::visit_at");
+        }
+        return _visit_table<R, Tup, F, B0, B...>[i](
+            static_cast<Tup&&>(tup),
+            static_cast<F&&>(func));
+    }
+} // namespace tuplet::detail
+
+namespace tuplet {
+    /// Calls func on element i of a non-empty tuple, where i is only known at
+    /// run time, forwarding the element with the tuple's value category.
+    /// Dispatch goes through a table of function pointers built at compile
+    /// time, so it takes the same time for every i. func must return the same
+    /// type for every element. Throws std::out_of_range if i >= N
+    template <TUPLET_WEAK_CONCEPT(base_list_tuple) Tup, class F>
+    TUPLET_INLINE constexpr decltype(auto) visit_at(
+        Tup&& tup,
+        size_t i,
+        F&& func) {
+        return detail::_visit_at(
+            static_cast<Tup&&>(tup),
+            i,
+            static_cast<F&&>(func),
+            base_list_t<Tup> {});
+    }
+} // namespace tuplet
+#endif
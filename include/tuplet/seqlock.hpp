@@ -0,0 +1,186 @@
+#ifndef TUPLET_SEQLOCK_HPP_IMPLEMENTATION
+#define TUPLET_SEQLOCK_HPP_IMPLEMENTATION
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+
+
+
+
+/////////////////////////////////
+////  tuplet::seqlock_tuple  ////
+/////////////////////////////////
+
+namespace tuplet {
+    /// A trivially copyable tuple with a single writer and any number of
+    /// readers, where readers never block the writer. The writer bumps a
+    /// sequence number before and after each write; readers copy the tuple,
+    /// and retry if the sequence number was odd (a write was in progress) or
+    /// changed while they were copying.
+    ///
+    /// The tuple is stored as an array of 8-byte atomic words, which are
+    /// read and written with relaxed atomics, so a reader racing with the
+    /// writer is well defined (it just retries). read<I>() only copies the
+    /// words overlapping element I.
+    ///
+    /// Writes must not run concurrently with each other; use one writer
+    /// thread, or serialize writers externally.
+    template <class... T>
+    class seqlock_tuple {
+       public:
+        using value_type = tuple<T...>;
+
+       private:
+        static_assert(
+            (std::is_trivially_copyable_v<T> && ...),
+            "seqlock_tuple requires trivially copyable elements");
+        static_assert(
+            alignof(value_type) <= alignof(uint64_t),
+            "seqlock_tuple does not support over-aligned elements");
+
+        constexpr static size_t _word_count = (sizeof(value_type) + 7) / 8;
+
+        template <size_t I>
+        using elem_t = std::tuple_element_t<I, value_type>;
+
+        /// Copy of the value, in the same words that are stored
+        struct _words {
+            uint64_t words[_word_count];
+        };
+
+       public:
+        seqlock_tuple() noexcept
+          : seqlock_tuple(value_type {}) {}
+        explicit seqlock_tuple(value_type const& value) noexcept
+          : _value(value) {
+            _words words = _words_of(value);
+            for (size_t i = 0; i < _word_count; i++) {
+                _data[i].store(words.words[i], std::memory_order_relaxed);
+            }
+        }
+
+        seqlock_tuple(seqlock_tuple const&) = delete;
+        seqlock_tuple& operator=(seqlock_tuple const&) = delete;
+
+        /// Returns a consistent copy of the tuple
+        value_type read() const noexcept {
+            _words words;
+            _read_words(words, 0, _word_count);
+            return _value_of(words);
+        }
+
+        /// Returns a consistent copy of element I, only reading the part of
+        /// the tuple that holds it
+        template <size_t I>
+        elem_t<I> read() const noexcept {
+            size_t offset = _offset_of<I>();
+            size_t first = offset / 8;
+            size_t last = (offset + sizeof(elem_t<I>) + 7) / 8;
+            _words words;
+            _read_words(words, first, last);
+            alignas(elem_t<I>) unsigned char bytes[sizeof(elem_t<I>)];
+            std::memcpy(
+                bytes,
+                reinterpret_cast<unsigned char const*>(words.words) + offset,
+                sizeof(elem_t<I>));
+            return *std::launder(reinterpret_cast<elem_t<I>*>(bytes));
+        }
+
+        /// Calls func with a reference to the tuple, then publishes the
+        /// result. func operates on the writer's own copy, so readers see
+        /// either the value before the write, or the value after it
+        template <class F>
+        void write(F&& func) {
+            // Working on a local copy lets the compiler keep small tuples in
+            // registers; updating _value in place, then reading it back as
+            // words, stalls on store forwarding
+            value_type value = _value;
+            static_cast<F&&>(func)(value);
+            _value = value;
+            _publish(value);
+        }
+
+        /// Replaces the tuple with value
+        void store(value_type const& value) noexcept {
+            _value = value;
+            _publish(value);
+        }
+
+       private:
+        /// Where element I really is. layout<value_type> only simulates the
+        /// layout, which differs for non-POD elements whose tail padding
+        /// the next element reuses, so this takes the address of element I
+        /// in _value instead (the writer may be changing _value, but its
+        /// address doesn't change). The difference is a constant, so the
+        /// compiler folds it away
+        template <size_t I>
+        size_t _offset_of() const noexcept {
+            return size_t(
+                reinterpret_cast<unsigned char const*>(&_value[tag<I>()])
+                - reinterpret_cast<unsigned char const*>(&_value));
+        }
+
+        static _words _words_of(value_type const& value) noexcept {
+            _words words {};
+            std::memcpy(words.words, &value, sizeof(value_type));
+            return words;
+        }
+
+        static value_type _value_of(_words const& words) noexcept {
+            alignas(value_type) unsigned char bytes[sizeof(value_type)];
+            std::memcpy(bytes, words.words, sizeof(value_type));
+            return *std::launder(reinterpret_cast<value_type*>(bytes));
+        }
+
+        /// Stores value between two bumps of the sequence number. The
+        /// release fence keeps the stores to the words from becoming visible
+        /// before the sequence number goes odd
+        void _publish(value_type const& value) noexcept {
+            _words words = _words_of(value);
+            uint64_t seq = _seq.load(std::memory_order_relaxed);
+            _seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < _word_count; i++) {
+                _data[i].store(words.words[i], std::memory_order_relaxed);
+            }
+            _seq.store(seq + 2, std::memory_order_release);
+        }
+
+        /// Copies words [first, last) from a point in time where no write
+        /// was in progress. The acquire fence keeps the loads of the words
+        /// from moving after the second load of the sequence number
+        void _read_words(_words& words, size_t first, size_t last)
+            const noexcept {
+            for (;;) {
+                uint64_t before = _seq.load(std::memory_order_acquire);
+                if ((before & 1) == 0) {
+                    for (size_t i = first; i < last; i++) {
+                        words.words[i] = _data[i].load(
+                            std::memory_order_relaxed);
+                    }
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (_seq.load(std::memory_order_relaxed) == before) {
+                        return;
+                    }
+                }
+                // The writer may have been preempted in the middle of a
+                // write, in which case spinning won't help
+                std::this_thread::yield();
+            }
+        }
+
+        std::atomic<uint64_t> _seq {0};
+        std::atomic<uint64_t> _data[_word_count];
+        /// The writer's copy of the value
+        value_type _value;
+    };
+} // namespace tuplet
+#endif
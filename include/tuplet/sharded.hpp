@@ -0,0 +1,195 @@
+#ifndef TUPLET_SHARDED_HPP_IMPLEMENTATION
+#define TUPLET_SHARDED_HPP_IMPLEMENTATION
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <tuplet/cacheline.hpp>
+#include <tuplet/seqlock.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+
+
+
+
+///////////////////////////////////////////
+////  tuplet::detail: Sharded Details  ////
+///////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// Combines element I of two tuples. Combine is either a tuple holding
+    /// one binary function per element, or a single binary function used
+    /// for every element
+    template <size_t I, class Combine, class A, class B>
+    constexpr auto _combine_elem(
+        Combine const& combine,
+        A const& a,
+        B const& b) {
+        if constexpr (_is_tuple<Combine>) {
+            return tuplet::get<I>(combine)(
+                tuplet::get<I>(a),
+                tuplet::get<I>(b));
+        } else {
+            return combine(tuplet::get<I>(a), tuplet::get<I>(b));
+        }
+    }
+
+    template <class Tup, class Combine, size_t... I>
+    constexpr void _combine_into(
+        Tup& acc,
+        Tup const& value,
+        Combine const& combine,
+        std::index_sequence<I...>) {
+        acc = Tup {static_cast<std::tuple_element_t<I, Tup>>(
+            _combine_elem<I>(combine, acc, value))...};
+    }
+
+    /// One thread's accumulator, on cache lines of its own. It's only
+    /// written by the thread that claimed it, and read by collect()
+    template <class... T>
+    struct alignas(cache_line_size) _shard {
+        seqlock_tuple<T...> value;
+        /// Guarded by the mutex of the sharded object
+        bool claimed = false;
+
+        explicit _shard(tuple<T...> const& identity)
+          : value(identity) {}
+    };
+} // namespace tuplet::detail
+
+
+
+
+
+///////////////////////////
+////  tuplet::sharded  ////
+///////////////////////////
+
+namespace tuplet {
+    template <class Tuple, class Combine>
+    class sharded;
+
+    /// Accumulates tuples from many threads without contention. Each thread
+    /// claims a shard, and adds values to it by combining them with its
+    /// current value elementwise; collect() combines every shard into one
+    /// tuple. Combine is either a tuple with one binary function per
+    /// element, or one binary function used for every element.
+    ///
+    ///     tuplet::sharded stats(
+    ///         tuplet::tuple {0u, 0.0, +inf, -inf},
+    ///         tuplet::tuple {std::plus<>(), std::plus<>(), min_fn, max_fn});
+    ///     auto shard = stats.claim();  // once per thread
+    ///     shard.add({1u, x, x, x});
+    ///     auto [count, sum, min, max] = stats.collect();
+    ///
+    /// Shards are seqlock_tuples, so adding to a shard only takes plain
+    /// stores, and collect() can read every shard while threads are still
+    /// adding to them. The initial value of each shard must be an identity
+    /// for the combine functions.
+    template <class... T, class Combine>
+    class sharded<tuple<T...>, Combine> {
+        using shard_t = detail::_shard<T...>;
+        using indices = std::index_sequence_for<T...>;
+
+       public:
+        using value_type = tuple<T...>;
+
+        /// A claimed shard. Only the thread that claimed it should add to
+        /// it; values added through it remain in the shard (and in
+        /// collect()) after it's released.
+        class handle {
+           public:
+            handle(handle&& other) noexcept
+              : _owner(std::exchange(other._owner, nullptr))
+              , _shard(other._shard) {}
+            handle& operator=(handle&&) = delete;
+
+            ~handle() {
+                if (_owner) {
+                    _owner->_release(_shard);
+                }
+            }
+
+            /// Combines value into the shard
+            void add(value_type const& value) {
+                auto const& combine = _owner->_combine;
+                _shard->value.write([&](value_type& acc) {
+                    detail::_combine_into(acc, value, combine, indices {});
+                });
+            }
+
+           private:
+            friend class sharded;
+            handle(sharded* owner, shard_t* shard) noexcept
+              : _owner(owner)
+              , _shard(shard) {}
+
+            sharded* _owner;
+            shard_t* _shard;
+        };
+
+        explicit sharded(value_type identity, Combine combine = {})
+          : _identity(identity)
+          , _combine(static_cast<Combine&&>(combine)) {}
+
+        sharded(sharded const&) = delete;
+        sharded& operator=(sharded const&) = delete;
+
+        /// Claims a shard for the calling thread, reusing a released shard
+        /// if there is one. Takes a lock, so claim once per thread and keep
+        /// the handle
+        handle claim() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto& shard : _shards) {
+                if (!shard.claimed) {
+                    shard.claimed = true;
+                    return {this, &shard};
+                }
+            }
+            // std::deque never moves its elements when growing at the end
+            _shards.emplace_back(_identity);
+            _shards.back().claimed = true;
+            return {this, &_shards.back()};
+        }
+
+        /// Combines the values of every shard. Each shard is read
+        /// consistently, but shards are read one after another, so the
+        /// result doesn't reflect a single point in time when threads are
+        /// still adding values
+        value_type collect() const {
+            std::lock_guard<std::mutex> lock(_mutex);
+            value_type result = _identity;
+            for (auto const& shard : _shards) {
+                detail::_combine_into(
+                    result,
+                    shard.value.read(),
+                    _combine,
+                    indices {});
+            }
+            return result;
+        }
+
+        /// Number of shards claimed so far (including released ones)
+        size_t shard_count() const {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _shards.size();
+        }
+
+       private:
+        void _release(shard_t* shard) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            shard->claimed = false;
+        }
+
+        value_type _identity;
+        Combine _combine;
+        mutable std::mutex _mutex;
+        std::deque<shard_t> _shards;
+    };
+
+    template <class... T, class Combine>
+    sharded(tuple<T...>, Combine) -> sharded<tuple<T...>, Combine>;
+} // namespace tuplet
+#endif
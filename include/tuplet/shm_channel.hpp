@@ -0,0 +1,546 @@
+#ifndef TUPLET_SHM_CHANNEL_HPP_IMPLEMENTATION
+#define TUPLET_SHM_CHANNEL_HPP_IMPLEMENTATION
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuplet/cacheline.hpp>
+#include <tuplet/layout.hpp>
+#include <tuplet/ring.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+/**
+ * tuplet::shm_channel needs POSIX shared memory (shm_open and mmap). On
+ * Linux, idle readers and writers sleep on a futex in the shared segment;
+ * on other POSIX systems they poll with short sleeps instead.
+ *
+ * With glibc older than 2.34, shm_open is in librt, so link with -lrt.
+ */
+
+
+
+
+
+/////////////////////////////////////////////////////
+////  tuplet::detail: Shared Memory Bookkeeping  ////
+/////////////////////////////////////////////////////
+
+namespace tuplet::detail {
+    constexpr uint64_t _fnv_offset = 0xcbf29ce484222325u;
+    constexpr uint64_t _fnv_prime = 0x100000001b3u;
+
+    constexpr uint64_t _fnv_mix(uint64_t hash, uint64_t value) {
+        for (int i = 0; i < 8; i++) {
+            hash = (hash ^ ((value >> (i * 8)) & 0xff)) * _fnv_prime;
+        }
+        return hash;
+    }
+
+    /// Distinguishes element types with the same size and alignment, so
+    /// that (say) a float and an int32_t don't produce the same fingerprint
+    template <class T>
+    constexpr uint64_t _elem_kind() {
+        if constexpr (std::is_floating_point_v<T>) {
+            return 1;
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            return 2;
+        } else if constexpr (std::is_integral_v<T>) {
+            return 3;
+        } else if constexpr (std::is_enum_v<T>) {
+            return 4;
+        } else if constexpr (std::is_pointer_v<T>) {
+            return 5;
+        } else {
+            return 6;
+        }
+    }
+
+    /// Hash of a tuple's layout: its size and alignment, and the offset,
+    /// size, alignment, and kind of each element. Two processes only share
+    /// a channel if they agree on it
+    template <class... T, size_t... I>
+    constexpr uint64_t _layout_fingerprint(std::index_sequence<I...>) {
+        using layout_t = layout<tuple<T...>>;
+        uint64_t hash = _fnv_offset;
+        hash = _fnv_mix(hash, layout_t::size);
+        hash = _fnv_mix(hash, layout_t::align);
+        hash = _fnv_mix(hash, sizeof...(T));
+        ((hash = _fnv_mix(hash, layout_t::offsets[I]),
+          hash = _fnv_mix(hash, sizeof(T)),
+          hash = _fnv_mix(hash, alignof(T)),
+          hash = _fnv_mix(hash, _elem_kind<T>())),
+         ...);
+        return hash;
+    }
+
+    /// Start of every shared segment. The producer's and consumer's indices
+    /// are on separate cache lines, each with the futex word its waiter
+    /// sleeps on, and a flag saying whether anyone's sleeping on it
+    struct _shm_header {
+        /// Version of this header layout. Bump when it changes
+        constexpr static uint64_t magic = 0x74706c74'73686d01u;
+
+        std::atomic<uint64_t> ready;
+        uint64_t fingerprint;
+        uint64_t capacity;
+        uint64_t cache_line;
+
+        struct alignas(cache_line_size) side {
+            std::atomic<uint64_t> index;
+            std::atomic<uint32_t> signal;
+            std::atomic<uint32_t> waiting;
+        };
+
+        /// Written by the producer, waited on by the consumer
+        side head;
+        /// Written by the consumer, waited on by the producer
+        side tail;
+    };
+
+    static_assert(
+        std::atomic<uint64_t>::is_always_lock_free
+            && std::atomic<uint32_t>::is_always_lock_free,
+        "Atomics in shared memory must be lock-free to work across "
+        "processes");
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+
+    /// Sleeps until signal is no longer expected (or spuriously)
+    inline void _shm_wait(
+        std::atomic<uint32_t>& signal,
+        uint32_t expected) noexcept {
+#if defined(__linux__)
+        // Not FUTEX_PRIVATE_FLAG, since the waker is in another process
+        syscall(
+            SYS_futex,
+            reinterpret_cast<uint32_t*>(&signal),
+            FUTEX_WAIT,
+            expected,
+            nullptr,
+            nullptr,
+            0);
+#else
+        if (signal.load(std::memory_order_acquire) == expected) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+#endif
+    }
+
+    inline void _shm_wake(std::atomic<uint32_t>& signal) noexcept {
+#if defined(__linux__)
+        syscall(
+            SYS_futex,
+            reinterpret_cast<uint32_t*>(&signal),
+            FUTEX_WAKE,
+            INT_MAX,
+            nullptr,
+            nullptr,
+            0);
+#else
+        (void)signal;
+#endif
+    }
+
+    [[noreturn]] inline void _throw_errno(char const* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+} // namespace tuplet::detail
+
+
+
+
+
+///////////////////////////////
+////  tuplet::shm_channel  ////
+///////////////////////////////
+
+namespace tuplet {
+    template <class Tuple>
+    class shm_channel;
+
+    /// A fixed-capacity ring of tuples in a POSIX shared memory segment,
+    /// for passing tuples from one process to another on the same host
+    /// without serializing them or making a syscall per tuple.
+    ///
+    ///     // producer process
+    ///     auto tx = tuplet::shm_channel<row_t>::create("/ticks", 4096);
+    ///     tx.send({id, price, size});
+    ///
+    ///     // consumer process
+    ///     auto rx = tuplet::shm_channel<row_t>::attach("/ticks");
+    ///     auto rows = rx.wait_readable();
+    ///     for (row_t const& row : rows) { ... }  // read in place
+    ///     rx.consume(rows.size());
+    ///
+    /// The segment starts with a fingerprint of the tuple's layout, and
+    /// attach() throws if it doesn't match, so processes built with
+    /// different definitions of the tuple can't misread each other.
+    ///
+    /// A channel has one producer and one consumer (either of which can be
+    /// the process that created it). Both spin briefly when the ring is
+    /// full (or empty), and then sleep on a futex in the segment, so an
+    /// idle channel costs no CPU. The segment outlives the processes using
+    /// it until it's removed with shm_channel::remove().
+    template <class... T>
+    class shm_channel<tuple<T...>> {
+        using header_t = detail::_shm_header;
+
+       public:
+        using value_type = tuple<T...>;
+
+        static_assert(
+            std::is_trivially_copyable_v<value_type>,
+            "shm_channel copies tuples between processes byte by byte, so "
+            "they must be trivially copyable");
+
+        /// Fingerprint of the layout of value_type
+        constexpr static uint64_t fingerprint = detail::_layout_fingerprint<
+            T...>(std::index_sequence_for<T...> {});
+
+        /// Contiguous rows that can be read in place
+        class rows {
+           public:
+            value_type const* begin() const noexcept { return _data; }
+            value_type const* end() const noexcept { return _data + _size; }
+            value_type const* data() const noexcept { return _data; }
+            size_t size() const noexcept { return _size; }
+            bool empty() const noexcept { return _size == 0; }
+            value_type const& operator[](size_t i) const noexcept {
+                return _data[i];
+            }
+
+           private:
+            friend class shm_channel;
+            rows(value_type const* data, size_t size) noexcept
+              : _data(data)
+              , _size(size) {}
+
+            value_type const* _data;
+            size_t _size;
+        };
+
+        /// Creates a segment named name (which should start with a '/'),
+        /// holding a ring of at least capacity tuples. Throws
+        /// std::system_error if the segment already exists
+        static shm_channel create(std::string const& name, size_t capacity) {
+            capacity = detail::_ring_capacity(capacity);
+            size_t size = _slots_offset + capacity * sizeof(value_type);
+
+            int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd < 0) {
+                detail::_throw_errno("shm_open");
+            }
+            if (ftruncate(fd, off_t(size)) != 0) {
+                int error = errno;
+                close(fd);
+                shm_unlink(name.c_str());
+                errno = error;
+                detail::_throw_errno("ftruncate");
+            }
+            void* memory;
+            try {
+                memory = _map(fd, size);
+            } catch (...) {
+                // _map has already closed fd. Don't leave an uninitialized
+                // segment behind for attach() to find
+                shm_unlink(name.c_str());
+                throw;
+            }
+            shm_channel channel(memory, size);
+            auto* header = new (channel._header) header_t();
+            header->fingerprint = fingerprint;
+            header->capacity = capacity;
+            header->cache_line = cache_line_size;
+            header->ready.store(header_t::magic, std::memory_order_release);
+            channel._mask = capacity - 1;
+            return channel;
+        }
+
+        /// Attaches to a segment made by create(), waiting up to timeout for
+        /// its creator to finish initializing it. Throws std::runtime_error
+        /// if it holds a different tuple layout
+        static shm_channel attach(
+            std::string const& name,
+            std::chrono::milliseconds timeout = std::chrono::seconds(1)) {
+            int fd = shm_open(name.c_str(), O_RDWR, 0);
+            if (fd < 0) {
+                detail::_throw_errno("shm_open");
+            }
+            auto deadline = std::chrono::steady_clock::now() + timeout;
+            // The creator sizes the segment right after creating it
+            struct stat info;
+            for (;;) {
+                if (fstat(fd, &info) != 0) {
+                    int error = errno;
+                    close(fd);
+                    errno = error;
+                    detail::_throw_errno("fstat");
+                }
+                if (size_t(info.st_size) >= _slots_offset) {
+                    break;
+                }
+                if (std::chrono::steady_clock::now() > deadline) {
+                    close(fd);
+                    throw std::runtime_error(
+                        "tuplet::shm_channel: timed out waiting for " + name
+                        + " to be initialized");
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            size_t size = size_t(info.st_size);
+            shm_channel channel(_map(fd, size), size);
+            header_t* header = channel._header;
+            while (header->ready.load(std::memory_order_acquire)
+                   != header_t::magic) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    throw std::runtime_error(
+                        "tuplet::shm_channel: timed out waiting for " + name
+                        + " to be initialized");
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            if (header->fingerprint != fingerprint
+                || header->cache_line != cache_line_size) {
+                throw std::runtime_error(
+                    "tuplet::shm_channel: " + name
+                    + " holds tuples with a different layout");
+            }
+            if (size < _slots_offset + header->capacity * sizeof(value_type)) {
+                throw std::runtime_error(
+                    "tuplet::shm_channel: " + name + " is truncated");
+            }
+            channel._mask = header->capacity - 1;
+            return channel;
+        }
+
+        /// Removes the segment named name. Processes that have it mapped
+        /// can keep using it
+        static void remove(std::string const& name) noexcept {
+            shm_unlink(name.c_str());
+        }
+
+        shm_channel(shm_channel&& other) noexcept
+          : _header(std::exchange(other._header, nullptr))
+          , _slots(other._slots)
+          , _size(other._size)
+          , _mask(other._mask)
+          , _cached_tail(other._cached_tail)
+          , _cached_head(other._cached_head) {}
+        shm_channel& operator=(shm_channel&&) = delete;
+
+        ~shm_channel() {
+            if (_header) {
+                munmap(_header, _size);
+            }
+        }
+
+        size_t capacity() const noexcept { return _mask + 1; }
+
+        /// Sends value, unless the ring is full. Producer only
+        bool try_send(value_type const& value) noexcept {
+            return send_n(&value, 1) == 1;
+        }
+
+        /// Sends value, waiting for space if the ring is full. Producer only
+        void send(value_type const& value) noexcept {
+            while (!try_send(value)) {
+                _wait_for_space();
+            }
+        }
+
+        /// Sends up to count values, as many as fit, and returns how many
+        /// were sent. The consumer sees all of them at once. Producer only
+        size_t send_n(value_type const* values, size_t count) noexcept {
+            uint64_t head = _header->head.index.load(std::memory_order_relaxed);
+            if (capacity() - (head - _cached_tail) < count) {
+                _cached_tail = _header->tail.index.load(
+                    std::memory_order_acquire);
+            }
+            size_t space = capacity() - size_t(head - _cached_tail);
+            count = count < space ? count : space;
+            for (size_t i = 0; i < count; i++) {
+                std::memcpy(
+                    _slot(head + i),
+                    values + i,
+                    sizeof(value_type));
+            }
+            if (count != 0) {
+                _header->head.index.store(
+                    head + count,
+                    std::memory_order_release);
+                _notify(_header->head);
+            }
+            return count;
+        }
+
+        /// Rows that can be read right now, in place. The rows stay valid
+        /// until they're consumed. Since they're contiguous, they stop at
+        /// the end of the ring, so there may be more rows after them.
+        /// Consumer only
+        rows readable() noexcept {
+            uint64_t tail = _header->tail.index.load(std::memory_order_relaxed);
+            if (_cached_head == tail) {
+                _cached_head = _header->head.index.load(
+                    std::memory_order_acquire);
+            }
+            size_t available = size_t(_cached_head - tail);
+            size_t to_end = capacity() - size_t(tail & _mask);
+            return {
+                _slot_value(tail),
+                available < to_end ? available : to_end};
+        }
+
+        /// Waits until there's at least one row to read, and returns the
+        /// readable rows. Consumer only
+        rows wait_readable() noexcept {
+            for (;;) {
+                rows result = readable();
+                if (!result.empty()) {
+                    return result;
+                }
+                _wait_for_data();
+            }
+        }
+
+        /// Frees the first count readable rows for the producer to reuse.
+        /// Consumer only
+        void consume(size_t count) noexcept {
+            uint64_t tail = _header->tail.index.load(std::memory_order_relaxed);
+            _header->tail.index.store(
+                tail + count,
+                std::memory_order_release);
+            _notify(_header->tail);
+        }
+
+        /// Copies the next row into out, unless the ring is empty.
+        /// Consumer only
+        bool try_receive(value_type& out) noexcept {
+            rows available = readable();
+            if (available.empty()) {
+                return false;
+            }
+            std::memcpy(&out, available.data(), sizeof(value_type));
+            consume(1);
+            return true;
+        }
+
+        /// Returns a copy of the next row, waiting for one if the ring is
+        /// empty. Consumer only
+        value_type receive() noexcept {
+            rows available = wait_readable();
+            value_type result;
+            std::memcpy(&result, available.data(), sizeof(value_type));
+            consume(1);
+            return result;
+        }
+
+       private:
+        /// Slots start on a cache line of their own, after the header
+        constexpr static size_t _slots_offset = detail::_align_up(
+            sizeof(header_t),
+            alignof(value_type) > cache_line_size ? alignof(value_type)
+                                                  : cache_line_size);
+
+        /// Iterations to spin before sleeping on the futex
+        constexpr static int _spin_count = 256;
+
+        static void* _map(int fd, size_t size) {
+            void* memory = mmap(
+                nullptr,
+                size,
+                PROT_READ | PROT_WRITE,
+                MAP_SHARED,
+                fd,
+                0);
+            int error = errno;
+            // The mapping keeps the segment alive without the descriptor
+            close(fd);
+            if (memory == MAP_FAILED) {
+                errno = error;
+                detail::_throw_errno("mmap");
+            }
+            return memory;
+        }
+
+        shm_channel(void* memory, size_t size) noexcept
+          : _header(static_cast<header_t*>(memory))
+          , _slots(static_cast<unsigned char*>(memory) + _slots_offset)
+          , _size(size) {}
+
+        void* _slot(uint64_t index) const noexcept {
+            return _slots + size_t(index & _mask) * sizeof(value_type);
+        }
+        value_type const* _slot_value(uint64_t index) const noexcept {
+            return std::launder(static_cast<value_type const*>(_slot(index)));
+        }
+
+        /// Wakes the other side if it's sleeping. The fence pairs with the
+        /// one in _wait(): either the waiter sees the new index, or this
+        /// sees that it's waiting
+        static void _notify(header_t::side& side) noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (side.waiting.load(std::memory_order_relaxed) != 0) {
+                side.signal.fetch_add(1, std::memory_order_release);
+                detail::_shm_wake(side.signal);
+            }
+        }
+
+        /// Waits for side.index to change from unchanged, spinning first,
+        /// then sleeping on the side's futex. May return early
+        static void _wait(header_t::side& side, uint64_t unchanged) noexcept {
+            for (int i = 0; i < _spin_count; i++) {
+                if (side.index.load(std::memory_order_relaxed) != unchanged) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+            uint32_t signal = side.signal.load(std::memory_order_acquire);
+            side.waiting.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (side.index.load(std::memory_order_relaxed) == unchanged) {
+                detail::_shm_wait(side.signal, signal);
+            }
+            side.waiting.store(0, std::memory_order_relaxed);
+        }
+
+        void _wait_for_space() noexcept {
+            uint64_t head = _header->head.index.load(std::memory_order_relaxed);
+            _wait(_header->tail, head - capacity());
+        }
+
+        void _wait_for_data() noexcept {
+            uint64_t tail = _header->tail.index.load(std::memory_order_relaxed);
+            _wait(_header->head, tail);
+        }
+
+        header_t* _header;
+        unsigned char* _slots;
+        size_t _size;
+        size_t _mask = 0;
+        /// The producer's last known value of the consumer's index
+        uint64_t _cached_tail = 0;
+        /// The consumer's last known value of the producer's index
+        uint64_t _cached_head = 0;
+    };
+} // namespace tuplet
+#endif
@@ -0,0 +1,389 @@
+#ifndef TUPLET_SORT_HPP_IMPLEMENTATION
+#define TUPLET_SORT_HPP_IMPLEMENTATION
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+
+
+
+
+////////////////////////////////////////////
+////  tuplet::detail: Sorting Networks  ////
+////////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// A comparator of a sorting network. It puts the smaller of the
+    /// elements at lo and hi (lo < hi) at lo, and the larger at hi
+    struct _compare_pair {
+        size_t lo;
+        size_t hi;
+    };
+
+    /// Writes Batcher's odd-even merge sort for n elements to out (if it
+    /// isn't null), and returns the number of comparators. This is the
+    /// network for the next power of two, less every comparator that
+    /// touches an element past the end
+    constexpr size_t _batcher_pairs(size_t n, _compare_pair* out) {
+        size_t count = 0;
+        for (size_t p = 1; p < n; p *= 2) {
+            for (size_t k = p; k >= 1; k /= 2) {
+                for (size_t j = k % p; j + k < n; j += 2 * k) {
+                    for (size_t i = 0; i < k && i + j + k < n; i++) {
+                        if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                            if (out) {
+                                out[count] = _compare_pair {i + j, i + j + k};
+                            }
+                            count++;
+                        }
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    template <size_t N>
+    constexpr auto _batcher_network() {
+        std::array<_compare_pair, _batcher_pairs(N, nullptr)> pairs {};
+        _batcher_pairs(N, pairs.data());
+        return pairs;
+    }
+
+    /// The comparators used to sort N elements, in order. Up to 16
+    /// elements, these are the smallest networks known (which are proven
+    /// optimal up to 12), arranged in layers of independent comparators.
+    /// Past that, it's Batcher's network
+    template <size_t N>
+    struct _sorting_network {
+        constexpr static auto pairs = _batcher_network<N>();
+    };
+
+    // clang-format off
+    template <>
+    struct _sorting_network<2> {
+        constexpr static _compare_pair pairs[] {
+            {0, 1},
+        };
+    };
+    template <>
+    struct _sorting_network<3> {
+        constexpr static _compare_pair pairs[] {
+            {0, 2},
+            {0, 1},
+            {1, 2},
+        };
+    };
+    template <>
+    struct _sorting_network<4> {
+        // 5 comparators in 3 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 2}, {1, 3},
+            {0, 1}, {2, 3},
+            {1, 2},
+        };
+    };
+    template <>
+    struct _sorting_network<5> {
+        // 9 comparators in 5 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 3}, {1, 4},
+            {0, 2}, {1, 3},
+            {0, 1}, {2, 4},
+            {1, 2}, {3, 4},
+            {2, 3},
+        };
+    };
+    template <>
+    struct _sorting_network<6> {
+        // 12 comparators in 5 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 5}, {1, 3}, {2, 4},
+            {1, 2}, {3, 4},
+            {0, 3}, {2, 5},
+            {0, 1}, {2, 3}, {4, 5},
+            {1, 2}, {3, 4},
+        };
+    };
+    template <>
+    struct _sorting_network<7> {
+        // 16 comparators in 6 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 6}, {2, 3}, {4, 5},
+            {0, 2}, {1, 4}, {3, 6},
+            {0, 1}, {2, 5}, {3, 4},
+            {1, 2}, {4, 6},
+            {2, 3}, {4, 5},
+            {1, 2}, {3, 4}, {5, 6},
+        };
+    };
+    template <>
+    struct _sorting_network<8> {
+        // 19 comparators in 6 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 2}, {1, 3}, {4, 6}, {5, 7},
+            {0, 4}, {1, 5}, {2, 6}, {3, 7},
+            {0, 1}, {2, 3}, {4, 5}, {6, 7},
+            {2, 4}, {3, 5},
+            {1, 4}, {3, 6},
+            {1, 2}, {3, 4}, {5, 6},
+        };
+    };
+    template <>
+    struct _sorting_network<9> {
+        // 25 comparators in 7 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 3}, {1, 7}, {2, 5}, {4, 8},
+            {0, 7}, {2, 4}, {3, 8}, {5, 6},
+            {0, 2}, {1, 3}, {4, 5}, {7, 8},
+            {1, 4}, {3, 6}, {5, 7},
+            {0, 1}, {2, 4}, {3, 5}, {6, 8},
+            {2, 3}, {4, 5}, {6, 7},
+            {1, 2}, {3, 4}, {5, 6},
+        };
+    };
+    template <>
+    struct _sorting_network<10> {
+        // 29 comparators in 8 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 8}, {1, 9}, {2, 7}, {3, 5}, {4, 6},
+            {0, 2}, {1, 4}, {5, 8}, {7, 9},
+            {0, 3}, {2, 4}, {5, 7}, {6, 9},
+            {0, 1}, {3, 6}, {8, 9},
+            {1, 5}, {2, 3}, {4, 8}, {6, 7},
+            {1, 2}, {3, 5}, {4, 6}, {7, 8},
+            {2, 3}, {4, 5}, {6, 7},
+            {3, 4}, {5, 6},
+        };
+    };
+    template <>
+    struct _sorting_network<11> {
+        // 35 comparators in 8 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 9}, {1, 6}, {2, 4}, {3, 7}, {5, 8},
+            {0, 1}, {3, 5}, {4, 10}, {6, 9}, {7, 8},
+            {1, 3}, {2, 5}, {4, 7}, {8, 10},
+            {0, 4}, {1, 2}, {3, 7}, {5, 9}, {6, 8},
+            {0, 1}, {2, 6}, {4, 5}, {7, 8}, {9, 10},
+            {2, 4}, {3, 6}, {5, 7}, {8, 9},
+            {1, 2}, {3, 4}, {5, 6}, {7, 8},
+            {2, 3}, {4, 5}, {6, 7},
+        };
+    };
+    template <>
+    struct _sorting_network<12> {
+        // 39 comparators in 9 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 8}, {1, 7}, {2, 6}, {3, 11}, {4, 10}, {5, 9},
+            {0, 1}, {2, 5}, {3, 4}, {6, 9}, {7, 8}, {10, 11},
+            {0, 2}, {1, 6}, {5, 10}, {9, 11},
+            {0, 3}, {1, 2}, {4, 6}, {5, 7}, {8, 11}, {9, 10},
+            {1, 4}, {3, 5}, {6, 8}, {7, 10},
+            {1, 3}, {2, 5}, {6, 9}, {8, 10},
+            {2, 3}, {4, 5}, {6, 7}, {8, 9},
+            {4, 6}, {5, 7},
+            {3, 4}, {5, 6}, {7, 8},
+        };
+    };
+    template <>
+    struct _sorting_network<13> {
+        // 45 comparators in 10 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 12}, {1, 10}, {2, 9}, {3, 7}, {5, 11}, {6, 8},
+            {1, 6}, {2, 3}, {4, 11}, {7, 9}, {8, 10},
+            {0, 4}, {1, 2}, {3, 6}, {7, 8}, {9, 10}, {11, 12},
+            {4, 6}, {5, 9}, {8, 11}, {10, 12},
+            {0, 5}, {3, 8}, {4, 7}, {6, 11}, {9, 10},
+            {0, 1}, {2, 5}, {6, 9}, {7, 8}, {10, 11},
+            {1, 3}, {2, 4}, {5, 6}, {9, 10},
+            {1, 2}, {3, 4}, {5, 7}, {6, 8},
+            {2, 3}, {4, 5}, {6, 7}, {8, 9},
+            {3, 4}, {5, 6},
+        };
+    };
+    template <>
+    struct _sorting_network<14> {
+        // 51 comparators in 10 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 13}, {1, 12}, {4, 8}, {5, 6}, {7, 11}, {9, 10},
+            {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {11, 12},
+            {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13},
+            {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9},
+            {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11},
+            {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13},
+            {2, 4}, {3, 6}, {9, 12}, {11, 13},
+            {3, 5}, {6, 8}, {7, 9}, {10, 12},
+            {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12},
+            {6, 7}, {8, 9},
+        };
+    };
+    template <>
+    struct _sorting_network<15> {
+        // 56 comparators in 10 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 13}, {1, 12}, {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10},
+            {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {8, 14}, {11, 12},
+            {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13},
+            {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14},
+            {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14},
+            {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {11, 14},
+            {2, 4}, {3, 6}, {9, 12}, {11, 13},
+            {3, 5}, {6, 8}, {7, 9}, {10, 12},
+            {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12},
+            {6, 7}, {8, 9},
+        };
+    };
+    template <>
+    struct _sorting_network<16> {
+        // 60 comparators in 10 layers
+        constexpr static _compare_pair pairs[] {
+            {0, 13}, {1, 12}, {2, 15}, {3, 14}, {4, 8}, {5, 6}, {7, 11},
+            {9, 10},
+            {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {8, 14}, {10, 15},
+            {11, 12},
+            {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13},
+            {14, 15},
+            {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14},
+            {13, 15},
+            {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14},
+            {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {11, 14},
+            {2, 4}, {3, 6}, {9, 12}, {11, 13},
+            {3, 5}, {6, 8}, {7, 9}, {10, 12},
+            {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12},
+            {6, 7}, {8, 9},
+        };
+    };
+    // clang-format on
+
+    template <class Compare, class T>
+    constexpr bool _is_std_less = std::is_same_v<Compare, std::less<>>
+                               || std::is_same_v<Compare, std::less<T>>;
+    template <class Compare, class T>
+    constexpr bool _is_std_greater = std::is_same_v<Compare, std::greater<>>
+                                  || std::is_same_v<Compare, std::greater<T>>;
+
+    /// Same as a < b for numbers, including NaN. GCC merges two selects on
+    /// the same comparison into a branch, but it doesn't merge this with <,
+    /// which lets each select compile to minss/maxss or a cmov
+    template <class T>
+    TUPLET_INLINE constexpr bool _unmerged_less(T a, T b) noexcept {
+#if defined(__GNUC__) && !defined(__clang__)
+        return __builtin_isless(a, b);
+#else
+        return a < b;
+#endif
+    }
+
+    /// Puts the smaller of elements I and J at I, and the larger at J.
+    /// Integers compared with std::less or std::greater get a separate min
+    /// and max, which compile to branchless cmov (compilers tend to branch
+    /// on a single comparison used for both). Floating point elements can't
+    /// use a separate min and max, which could both pick the same value
+    /// when one is NaN, or of -0.0 and 0.0. Instead, both are selected by
+    /// the same comparison, written twice so that it isn't merged into a
+    /// branch (see _unmerged_less). Other trivially copyable elements are
+    /// both selected by one comparison, and anything else is swapped only
+    /// when it's out of order
+    template <size_t I, size_t J, class Tup, class Compare>
+    TUPLET_INLINE constexpr void _compare_exchange(Tup& tup, Compare& comp) {
+        auto& a = tup[tag<I>()];
+        auto& b = tup[tag<J>()];
+        using elem_t = std::remove_reference_t<decltype(a)>;
+        if constexpr (
+            std::is_integral_v<elem_t> && _is_std_less<Compare, elem_t>) {
+            elem_t x = a;
+            elem_t y = b;
+            a = y < x ? y : x;
+            b = x < y ? y : x;
+        } else if constexpr (
+            std::is_integral_v<elem_t> && _is_std_greater<Compare, elem_t>) {
+            elem_t x = a;
+            elem_t y = b;
+            a = x < y ? y : x;
+            b = y < x ? y : x;
+        } else if constexpr (
+            std::is_floating_point_v<elem_t>
+            && _is_std_less<Compare, elem_t>) {
+            elem_t x = a;
+            elem_t y = b;
+            a = y < x ? y : x;
+            b = _unmerged_less(y, x) ? x : y;
+        } else if constexpr (
+            std::is_floating_point_v<elem_t>
+            && _is_std_greater<Compare, elem_t>) {
+            elem_t x = a;
+            elem_t y = b;
+            a = x < y ? y : x;
+            b = _unmerged_less(x, y) ? x : y;
+        } else if constexpr (std::is_trivially_copyable_v<elem_t>) {
+            elem_t x = a;
+            elem_t y = b;
+            bool swap = comp(y, x);
+            a = swap ? y : x;
+            b = swap ? x : y;
+        } else if (comp(b, a)) {
+            using std::swap;
+            swap(a, b);
+        }
+    }
+
+    template <class Net, class Tup, class Compare, size_t... K>
+    TUPLET_INLINE constexpr void _run_network(
+        Tup& tup,
+        Compare& comp,
+        std::index_sequence<K...>) {
+        (_compare_exchange<Net::pairs[K].lo, Net::pairs[K].hi>(tup, comp),
+         ...);
+    }
+} // namespace tuplet::detail
+
+
+
+
+
+/////////////////////////////////////////////////
+////  tuplet::sort_elements, tuplet::sorted  ////
+/////////////////////////////////////////////////
+
+namespace tuplet {
+    /// Sorts the elements of a homogeneous tuple in place, so that
+    /// comp(get<J>(tup), get<I>(tup)) is false for every I < J. The
+    /// sequence of comparisons is a sorting network fixed at compile time
+    /// from the size of the tuple, so there are no loops, and for numbers
+    /// there are no branches either. The sort isn't stable.
+    ///
+    /// Sorting a tuple of references (such as one made by tuplet::tie)
+    /// sorts the referenced values. The result is always a permutation of
+    /// the input, even for floats that are NaN (which aren't ordered, so
+    /// they may end up anywhere) or signed zeros.
+    template <class T, class... U, class Compare = std::less<>>
+    TUPLET_INLINE constexpr void sort_elements(
+        tuple<T, U...>& tup,
+        Compare comp = Compare()) {
+        static_assert(
+            detail::_is_homogeneous<T, U...>,
+            "tuplet::sort_elements requires every element to have the same "
+            "type");
+        using net = detail::_sorting_network<1 + sizeof...(U)>;
+        detail::_run_network<net>(
+            tup,
+            comp,
+            std::make_index_sequence<std::size(net::pairs)>());
+    }
+
+    /// Returns a copy of a homogeneous tuple with its elements sorted (see
+    /// sort_elements)
+    template <class T, class... U, class Compare = std::less<>>
+    TUPLET_INLINE constexpr tuple<T, U...> sorted(
+        tuple<T, U...> tup,
+        Compare comp = Compare()) {
+        sort_elements(tup, comp);
+        return tup;
+    }
+} // namespace tuplet
+#endif
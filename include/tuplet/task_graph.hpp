@@ -0,0 +1,317 @@
+#ifndef TUPLET_TASK_GRAPH_HPP_IMPLEMENTATION
+#define TUPLET_TASK_GRAPH_HPP_IMPLEMENTATION
+
+#include <atomic>
+#include <cstddef>
+#include <tuple>
+#include <tuplet/tuple.hpp>
+#include <tuplet/work_stealing_pool.hpp>
+#include <type_traits>
+#include <utility>
+
+
+
+
+
+///////////////////////////////////
+////  tuplet::node and inputs  ////
+///////////////////////////////////
+
+namespace tuplet {
+    /// Indices of the nodes whose outputs are passed to a node, in the order
+    /// they're passed
+    template <size_t... I>
+    struct inputs_t {};
+    template <size_t... I>
+    constexpr inputs_t<I...> inputs {};
+
+    /// A node in a task_graph: a function, and the nodes it takes its inputs
+    /// from. Use tuplet::node() to create one
+    template <class F, size_t... Inputs>
+    struct graph_node {
+        constexpr static size_t input_count = sizeof...(Inputs);
+        constexpr static size_t input_indices[input_count + 1] {Inputs...};
+
+        F func;
+    };
+
+    /// A node with no inputs
+    template <class F>
+    constexpr graph_node<std::decay_t<F>> node(F&& func) {
+        return {static_cast<F&&>(func)};
+    }
+
+    /// A node whose function is called with the outputs of the given nodes
+    template <class F, size_t... I>
+    constexpr graph_node<std::decay_t<F>, I...> node(F&& func, inputs_t<I...>) {
+        return {static_cast<F&&>(func)};
+    }
+} // namespace tuplet
+
+
+
+
+
+//////////////////////////////////////////////
+////  tuplet::detail: Task Graph Details  ////
+//////////////////////////////////////////////
+
+namespace tuplet::detail {
+    template <class Graph, size_t K>
+    struct _graph_output;
+
+    struct _invalid_input {
+        using type = tuple<>;
+    };
+
+    template <class Graph, size_t K, class Node>
+    struct _node_output;
+
+    template <class Graph, size_t K, class F, size_t... I>
+    struct _node_output<Graph, K, graph_node<F, I...>> {
+        constexpr static bool inputs_valid = ((I < K) && ...);
+        static_assert(
+            inputs_valid,
+            "A node can only take inputs from nodes that come before it");
+
+        template <size_t J>
+        using input_value_t = typename std::conditional_t<
+            inputs_valid,
+            _graph_output<Graph, J>,
+            _invalid_input>::type;
+
+        using input_type = tuple<input_value_t<I> const&...>;
+
+        static_assert(
+            std::is_invocable_v<F&, input_value_t<I> const&...>,
+            "The function of a node must be callable with the outputs of "
+            "its inputs, in order");
+
+        using result_type = std::invoke_result_t<F&, input_value_t<I> const&...>;
+
+        /// void outputs are stored as empty tuples
+        using type = std::
+            conditional_t<std::is_void_v<result_type>, tuple<>, result_type>;
+    };
+
+    template <class Graph, size_t K>
+    struct _graph_output
+      : _node_output<Graph, K, std::tuple_element_t<K, Graph>> {};
+
+    /// Edges of the graph, from each node to the nodes that take its output
+    /// as an input, stored as adjacency lists packed into one array
+    template <size_t N, size_t E>
+    struct _graph_edges {
+        size_t input_count[N + 1] {};
+        size_t first_dependent[N + 1] {};
+        size_t dependents[E + 1] {};
+    };
+
+    template <class... Nodes>
+    constexpr auto _compute_edges() {
+        constexpr size_t N = sizeof...(Nodes);
+        constexpr size_t E = (Nodes::input_count + ... + 0);
+        _graph_edges<N, E> edges;
+        size_t const* inputs[N + 1] {Nodes::input_indices...};
+        size_t input_count[N + 1] {Nodes::input_count...};
+
+        // Count the dependents of each node, then place them
+        size_t dependent_count[N + 1] {};
+        for (size_t k = 0; k < N; k++) {
+            edges.input_count[k] = input_count[k];
+            for (size_t i = 0; i < input_count[k]; i++) {
+                dependent_count[inputs[k][i]]++;
+            }
+        }
+        for (size_t k = 0; k < N; k++) {
+            edges.first_dependent[k + 1] = edges.first_dependent[k]
+                                         + dependent_count[k];
+        }
+        size_t placed[N + 1] {};
+        for (size_t k = 0; k < N; k++) {
+            for (size_t i = 0; i < input_count[k]; i++) {
+                size_t input = inputs[k][i];
+                edges.dependents[edges.first_dependent[input] + placed[input]++] =
+                    k;
+            }
+        }
+        return edges;
+    }
+
+    struct _call_and_discard {
+        template <class F, class... Args>
+        tuple<> operator()(F& func, Args&&... args) const {
+            func(static_cast<Args&&>(args)...);
+            return {};
+        }
+    };
+    struct _call {
+        template <class F, class... Args>
+        decltype(auto) operator()(F& func, Args&&... args) const {
+            return func(static_cast<Args&&>(args)...);
+        }
+    };
+} // namespace tuplet::detail
+
+
+
+
+
+//////////////////////////////
+////  tuplet::task_graph  ////
+//////////////////////////////
+
+namespace tuplet {
+    /// A static graph of tasks, where each node is a function taking the
+    /// outputs of earlier nodes as its inputs. Inputs and outputs are
+    /// checked at compile time: input_t<K> is the tuple of (const
+    /// references to) outputs passed to node K, and output_t<K> is the type
+    /// it returns (tuple<> if it returns void).
+    ///
+    /// run() executes the graph on a work_stealing_pool. A node is queued
+    /// as soon as all of its inputs are ready, so independent nodes run in
+    /// parallel. Outputs are stored in slots that are allocated up front,
+    /// along with the rest of the state needed to run the graph, so running
+    /// a graph doesn't allocate.
+    ///
+    ///     tuplet::task_graph graph {
+    ///         tuplet::node([] { return load_a(); }),
+    ///         tuplet::node([] { return load_b(); }),
+    ///         tuplet::node(combine, tuplet::inputs<0, 1>)};
+    ///     auto [a, b, combined] = graph.run(pool);
+    template <class... Nodes>
+    class task_graph {
+        using graph_t = tuple<Nodes...>;
+        using indices = std::index_sequence_for<Nodes...>;
+        constexpr static size_t N = sizeof...(Nodes);
+
+       public:
+        template <size_t K>
+        using output_t = typename detail::_graph_output<graph_t, K>::type;
+
+        template <size_t K>
+        using input_t = typename detail::_graph_output<graph_t, K>::input_type;
+
+       private:
+        template <class Seq>
+        struct _results;
+        template <size_t... K>
+        struct _results<std::index_sequence<K...>> {
+            using type = tuple<output_t<K>...>;
+            using slots = detail::_result_slots<
+                detail::_result_slot<tag<K>, output_t<K>>...>;
+        };
+
+       public:
+        /// Outputs of every node, in order
+        using result_type = typename _results<indices>::type;
+
+        constexpr explicit task_graph(Nodes... nodes)
+          : _nodes {static_cast<Nodes&&>(nodes)...} {}
+
+        /// Runs every node, and returns their outputs. If a node throws, any
+        /// node that hasn't started yet is skipped, and the first exception
+        /// is rethrown once the nodes already running have finished.
+        result_type run(work_stealing_pool& pool) {
+            if constexpr (N == 0) {
+                return {};
+            } else {
+                _run_state state(*this, pool);
+                for (size_t k = 0; k < N; k++) {
+                    state.waiting[k].store(
+                        _edges.input_count[k],
+                        std::memory_order_relaxed);
+                }
+                for (size_t k = 0; k < N; k++) {
+                    if (_edges.input_count[k] == 0) {
+                        pool.submit({&_run_node, &state, k});
+                    }
+                }
+                pool.wait(state.join);
+                return _take(state, indices {});
+            }
+        }
+
+       private:
+        using slots_t = typename _results<indices>::slots;
+
+        constexpr static auto _edges = detail::_compute_edges<Nodes...>();
+
+        struct _run_state {
+            _run_state(task_graph& graph, work_stealing_pool& pool) noexcept
+              : graph(graph)
+              , pool(pool) {}
+
+            task_graph& graph;
+            work_stealing_pool& pool;
+            detail::_steal_join join {N};
+            /// Number of unfinished inputs of each node
+            std::atomic<size_t> waiting[N + 1];
+            slots_t slots;
+        };
+
+        template <size_t K, class F, size_t... I>
+        static void _invoke(_run_state& state, graph_node<F, I...>& node) {
+            using call = std::conditional_t<
+                std::is_void_v<
+                    typename detail::_graph_output<graph_t, K>::result_type>,
+                detail::_call_and_discard,
+                detail::_call>;
+            call fn;
+            detail::_slot_for<tag<K>>(state.slots)
+                .emplace(
+                    fn,
+                    node.func,
+                    std::as_const(
+                        detail::_slot_for<tag<I>>(state.slots).get())...);
+        }
+
+        template <size_t K>
+        static void _run(_run_state& state) {
+            // If a node failed, nodes after it may be missing inputs
+            if (!state.join.failed.load(std::memory_order_acquire)) {
+                try {
+                    _invoke<K>(state, tuplet::get<K>(state.graph._nodes));
+                } catch (...) {
+                    state.join.fail();
+                }
+            }
+            for (size_t i = _edges.first_dependent[K];
+                 i < _edges.first_dependent[K + 1];
+                 i++) {
+                size_t dependent = _edges.dependents[i];
+                if (state.waiting[dependent].fetch_sub(
+                        1,
+                        std::memory_order_acq_rel)
+                    == 1) {
+                    state.pool.submit({&_run_node, &state, dependent});
+                }
+            }
+            state.pool.finish(state.join);
+        }
+
+        template <size_t... K>
+        static void _dispatch(
+            _run_state& state,
+            size_t k,
+            std::index_sequence<K...>) {
+            constexpr static void (*runners[])(_run_state&) {&_run<K>...};
+            runners[k](state);
+        }
+
+        static void _run_node(void* state, size_t k) {
+            _dispatch(*static_cast<_run_state*>(state), k, indices {});
+        }
+
+        template <size_t... K>
+        static result_type _take(_run_state& state, std::index_sequence<K...>) {
+            return {detail::_slot_for<tag<K>>(state.slots).take()...};
+        }
+
+        graph_t _nodes;
+    };
+
+    template <class... Nodes>
+    task_graph(Nodes...) -> task_graph<Nodes...>;
+} // namespace tuplet
+#endif
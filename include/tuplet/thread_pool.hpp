@@ -0,0 +1,177 @@
+#ifndef TUPLET_THREAD_POOL_HPP_IMPLEMENTATION
+#define TUPLET_THREAD_POOL_HPP_IMPLEMENTATION
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+
+
+///////////////////////////////////////////////
+////  tuplet::detail: Thread Pool Details  ////
+///////////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// Shared by the tasks of a single call to fork_join. Guarded by the
+    /// mutex of the pool
+    struct _join_state {
+        size_t remaining;
+        std::exception_ptr error {};
+    };
+
+    /// A task submitted to the pool. The task itself lives on the stack of
+    /// the thread that called fork_join, which outlives the job because it
+    /// doesn't return until every job has finished
+    struct _pool_job {
+        void (*run)(void*);
+        void* task;
+        _join_state* join;
+    };
+
+    template <class F>
+    void _run_task(void* task) {
+        (*static_cast<F*>(task))();
+    }
+} // namespace tuplet::detail
+
+
+
+
+
+//////////////////////////////
+////  tuplet::thread_pool  ////
+//////////////////////////////
+
+namespace tuplet {
+    /// A fixed set of worker threads that run tasks submitted with
+    /// fork_join(). The thread calling fork_join() runs tasks too while it
+    /// waits, so nested calls to fork_join() from inside a task can't
+    /// deadlock, and a pool with no worker threads runs everything inline.
+    class thread_pool {
+       public:
+        /// The calling thread takes part in fork_join, so by default there's
+        /// one worker fewer than there are hardware threads
+        thread_pool()
+          : thread_pool(
+              std::thread::hardware_concurrency() > 1
+                  ? std::thread::hardware_concurrency() - 1
+                  : 0) {}
+
+        explicit thread_pool(size_t worker_count) {
+            _workers.reserve(worker_count);
+            for (size_t i = 0; i < worker_count; i++) {
+                _workers.emplace_back([this] { _work(); });
+            }
+        }
+
+        thread_pool(thread_pool const&) = delete;
+        thread_pool& operator=(thread_pool const&) = delete;
+
+        ~thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _ready.notify_all();
+            for (auto& worker : _workers) {
+                worker.join();
+            }
+        }
+
+        /// Number of worker threads (not counting threads calling fork_join)
+        size_t size() const noexcept { return _workers.size(); }
+
+        /// Runs every task, possibly in parallel, and returns once all of
+        /// them have finished. If any task throws, the first exception is
+        /// rethrown after the remaining tasks have finished.
+        template <class... F>
+        void fork_join(F&&... tasks) {
+            if constexpr (sizeof...(F) != 0) {
+                detail::_join_state join {sizeof...(F)};
+                detail::_pool_job jobs[] {detail::_pool_job {
+                    &detail::_run_task<std::remove_reference_t<F>>,
+                    std::addressof(tasks),
+                    &join}...};
+
+                if constexpr (sizeof...(F) > 1) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _jobs.insert(_jobs.end(), jobs + 1, jobs + sizeof...(F));
+                }
+                if (sizeof...(F) > 2) {
+                    _ready.notify_all();
+                } else if (sizeof...(F) == 2) {
+                    _ready.notify_one();
+                }
+
+                // Run the first task here rather than waiting for a worker
+                _run(jobs[0]);
+
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (join.remaining != 0) {
+                    if (_jobs.empty()) {
+                        _joined.wait(lock);
+                        continue;
+                    }
+                    // Help out while we wait, so that nested fork_join calls
+                    // always make progress
+                    detail::_pool_job job = _jobs.front();
+                    _jobs.pop_front();
+                    lock.unlock();
+                    _run(job);
+                    lock.lock();
+                }
+                if (join.error) {
+                    std::rethrow_exception(join.error);
+                }
+            }
+        }
+
+       private:
+        void _work() {
+            std::unique_lock<std::mutex> lock(_mutex);
+            for (;;) {
+                _ready.wait(lock, [this] { return _stopping || !_jobs.empty(); });
+                if (_jobs.empty()) {
+                    return;
+                }
+                detail::_pool_job job = _jobs.front();
+                _jobs.pop_front();
+                lock.unlock();
+                _run(job);
+                lock.lock();
+            }
+        }
+
+        void _run(detail::_pool_job job) noexcept {
+            std::exception_ptr error;
+            try {
+                job.run(job.task);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (error && !job.join->error) {
+                job.join->error = error;
+            }
+            if (--job.join->remaining == 0) {
+                _joined.notify_all();
+            }
+        }
+
+        std::mutex _mutex;
+        std::condition_variable _ready;
+        std::condition_variable _joined;
+        std::deque<detail::_pool_job> _jobs;
+        bool _stopping = false;
+        std::vector<std::thread> _workers;
+    };
+} // namespace tuplet
+#endif
@@ -2,6 +2,7 @@
 #define TUPLET_TUPLET_HPP_IMPLEMENTATION
 
 #include <cstddef>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -269,6 +270,10 @@ namespace tuplet::detail {
     struct _forward_as<Tup const&&, B> {
         using type = B const&&;
     };
+
+    /// True for tuplet::lazy_map_view (specialized where it's defined)
+    template <class T>
+    constexpr bool _is_lazy_map_view = false;
 } // namespace tuplet::detail
 
 
@@ -335,6 +340,11 @@ namespace tuplet {
         typename std::decay_t<Tuple>::base_list;
     };
 
+    /// Anything tuple_cat accepts: tuples, and lazy_map views of them
+    template <class Tuple>
+    concept cat_operand = base_list_tuple<Tuple>
+                       || detail::_is_lazy_map_view<std::decay_t<Tuple>>;
+
     template <class T>
     concept stateless = std::is_empty_v<std::decay_t<T>>;
 
@@ -699,9 +709,18 @@ namespace tuplet {
 namespace tuplet {
     template <class... T>
     struct tuple;
+    template <class Tuple, class F>
+    struct lazy_map_view;
 }
 
 namespace tuplet::detail {
+    /// True for tuplet::tuple, and false for anything else (including
+    /// references to tuples)
+    template <class T>
+    constexpr bool _is_tuple = false;
+    template <class... T>
+    constexpr bool _is_tuple<tuple<T...>> = true;
+
     template <class Tup, class F, class... B>
     TUPLET_INLINE constexpr void _for_each(
         Tup&& tup,
@@ -732,12 +751,173 @@ namespace tuplet::detail {
 #endif
     }
 
+    /// Like _any, but calls func on every element, and combines the
+    /// results with |, so there are no branches between the calls
+    template <class Tup, class F, class... B>
+    TUPLET_INLINE constexpr bool _any_eager(
+        Tup&& tup,
+        F&& func,
+        type_list<B...>) {
+#ifdef _MSC_VER
+        return [&](auto&&... v1) -> bool {
+            return (false | ... | bool(func(static_cast<decltype(v1)&&>(v1))));
+        }(TUPLET_FWD_M(Tup, B, tup, value)...);
+#else
+        return (false | ... | bool(func(TUPLET_FWD_M(Tup, B, tup, value))));
+#endif
+    }
+
+    /// Like _all, but calls func on every element, and combines the
+    /// results with &, so there are no branches between the calls
+    template <class Tup, class F, class... B>
+    TUPLET_INLINE constexpr bool _all_eager(
+        Tup&& tup,
+        F&& func,
+        type_list<B...>) {
+#ifdef _MSC_VER
+        return [&](auto&&... v1) -> bool {
+            return (true & ... & bool(func(static_cast<decltype(v1)&&>(v1))));
+        }(TUPLET_FWD_M(Tup, B, tup, value)...);
+#else
+        return (true & ... & bool(func(TUPLET_FWD_M(Tup, B, tup, value))));
+#endif
+    }
+
     template <class Tup, class F, class... B>
     TUPLET_INLINE constexpr auto _map(Tup&& tup, F&& func, type_list<B...>)
         -> tuple<decltype(func(TUPLET_FWD_M(Tup, B, tup, value)))...> {
         return {func(TUPLET_FWD_M(Tup, B, tup, value))...};
     }
 
+    /// Combines the leaves Lo through Hi - 1 in a balanced binary tree, so
+    /// the longest chain of dependent calls to op is log2(Hi - Lo) deep,
+    /// rather than Hi - Lo - 1 deep as with a fold expression
+    template <size_t Lo, size_t Hi, class Leaf, class Op>
+    TUPLET_INLINE constexpr auto _tree_fold(Leaf& leaf, Op& op) {
+        if constexpr (Hi - Lo == 1) {
+            return leaf(tag<Lo>());
+        } else {
+            constexpr size_t mid = Lo + (Hi - Lo) / 2;
+            return op(
+                _tree_fold<Lo, mid>(leaf, op),
+                _tree_fold<mid, Hi>(leaf, op));
+        }
+    }
+
+    template <class Tup, class Op>
+    TUPLET_INLINE constexpr auto _reduce(Tup&& tup, Op& op) {
+        auto leaf = [&](auto index) { return static_cast<Tup&&>(tup)[index]; };
+        return _tree_fold<0, std::decay_t<Tup>::N>(leaf, op);
+    }
+
+    template <class T, class... U>
+    constexpr bool _is_homogeneous = (std::is_same_v<T, U> && ...);
+
+    /// True if the elements of a tuple are laid out like an array: they all
+    /// have the same type, which isn't a reference (stored as a pointer) or
+    /// empty, and the tuple is exactly N times the size of that type. Bases
+    /// are laid out in declaration order, so with no room for padding,
+    /// element i is i * sizeof(T) bytes from element 0
+    template <class Tup>
+    constexpr bool _is_array_like = false;
+    template <class T, class... U>
+    constexpr bool _is_array_like<tuple<T, U...>> =
+        _is_homogeneous<T, U...> && !std::is_reference_v<T>
+        && !std::is_empty_v<T>
+        && sizeof(tuple<T, U...>) == (1 + sizeof...(U)) * sizeof(T);
+
+    /// An element of a homogeneous tuple, along with its index
+    template <class T>
+    struct _indexed {
+        T value;
+        size_t index;
+    };
+
+    /// Finds the element for which better(element, other) holds against
+    /// every other element, preferring the lowest index on ties
+    template <class Tup, class Better>
+    TUPLET_INLINE constexpr auto _select(Tup const& tup, Better better) {
+        using elem_t = std::decay_t<decltype(tup[tag<0>()])>;
+        auto leaf = [&](auto index) {
+            return _indexed<elem_t> {tup[index], index.value};
+        };
+        // Elements in the left subtree always have lower indices
+        auto op = [&](auto const& left, auto const& right) {
+            return better(right.value, left.value) ? right : left;
+        };
+        return _tree_fold<0, Tup::N>(leaf, op);
+    }
+
+    template <class Pool, class Tup, class F, class... B>
+    void _parallel_for_each(Pool& pool, Tup&& tup, F&& func, type_list<B...>) {
+        pool.fork_join([&] { func(TUPLET_FWD_M(Tup, B, tup, value)); }...);
+    }
+
+    /// Result of calling func on the element of tup stored in base B
+    template <class Tup, class F, class B>
+    using _elem_result_t = decltype(std::declval<F&>()(
+        static_cast<forward_as_t<Tup&&, B>>(std::declval<Tup&>()).value));
+
+    /// Holds the result of one task of parallel_map until every task has
+    /// finished. Key is the base holding the element that the result was
+    /// computed from, so that each slot is a distinct base of _result_slots
+    template <class Key, class R, bool = std::is_reference_v<R>>
+    struct _result_slot {
+        union {
+            R value;
+        };
+        bool engaged = false;
+
+        _result_slot() noexcept {}
+        _result_slot(_result_slot const&) = delete;
+        ~_result_slot() {
+            if (engaged) {
+                value.~R();
+            }
+        }
+
+        template <class F, class... Args>
+        void emplace(F& func, Args&&... args) {
+            ::new (static_cast<void*>(&value))
+                R(func(static_cast<Args&&>(args)...));
+            engaged = true;
+        }
+        R& get() noexcept { return value; }
+        R take() { return static_cast<R&&>(value); }
+    };
+
+    /// References are stored as pointers
+    template <class Key, class R>
+    struct _result_slot<Key, R, true> {
+        std::remove_reference_t<R>* ptr = nullptr;
+
+        template <class F, class... Args>
+        void emplace(F& func, Args&&... args) {
+            auto&& result = func(static_cast<Args&&>(args)...);
+            ptr = &result;
+        }
+        std::remove_reference_t<R>& get() noexcept { return *ptr; }
+        R take() { return static_cast<R>(*ptr); }
+    };
+
+    template <class... Slots>
+    struct _result_slots : Slots... {};
+
+    template <class Key, class R, bool Ref>
+    _result_slot<Key, R, Ref>& _slot_for(_result_slot<Key, R, Ref>& slot) {
+        return slot;
+    }
+
+    template <class Pool, class Tup, class F, class... B>
+    auto _parallel_map(Pool& pool, Tup&& tup, F&& func, type_list<B...>)
+        -> tuple<_elem_result_t<Tup, F, B>...> {
+        _result_slots<_result_slot<B, _elem_result_t<Tup, F, B>>...> slots;
+        pool.fork_join([&] {
+            _slot_for<B>(slots).emplace(func, TUPLET_FWD_M(Tup, B, tup, value));
+        }...);
+        return {_slot_for<B>(slots).take()...};
+    }
+
     template <class Tup, class F, class... B>
     TUPLET_INLINE constexpr decltype(auto) _apply(
         Tup&& t,
@@ -780,11 +960,24 @@ namespace tuplet {
         template <TUPLET_OTHER_THAN(tuple, U)> // Preserves default assignments
         TUPLET_INLINE constexpr auto& operator=(U&& tup) {
             using tuple2 = std::decay_t<U>;
+            using value_tuple =
+                tuple<std::remove_cv_t<std::remove_reference_t<T>>...>;
             if constexpr (base_list_tuple_v<tuple2>) {
                 _assign_tup(
                     static_cast<U&&>(tup),
                     base_list {},
                     typename tuple2::base_list {});
+            } else if constexpr (std::is_convertible_v<U&&, value_tuple>) {
+                // Types that convert to a tuple (such as elementwise
+                // expressions) compute every element before any is assigned,
+                // so the compiler doesn't have to assume that assigning one
+                // element changes the inputs of the next. They're computed as
+                // values, so this works for tuples of references too
+                value_tuple values = static_cast<U&&>(tup);
+                _assign_tup(
+                    static_cast<value_tuple&&>(values),
+                    base_list {},
+                    typename value_tuple::base_list {});
             } else {
                 _assign_index_tup(static_cast<U&&>(tup), tag_range<N>());
             }
@@ -945,6 +1138,57 @@ namespace tuplet {
                 base_list {});
         }
 
+        // Like any, but always applies the function to every element, and
+        // combines the results with a bitwise or. There are no branches
+        // between applications, so for cheap predicates on arithmetic
+        // elements the compiler can evaluate them with SIMD compares. Faster
+        // than any when the results are hard for the CPU to predict
+        template <class F>
+        TUPLET_INLINE constexpr bool any_eager(F&& func) & {
+            return detail::_any_eager(
+                *this,
+                static_cast<F&&>(func),
+                base_list {});
+        }
+        template <class F>
+        TUPLET_INLINE constexpr bool any_eager(F&& func) const& {
+            return detail::_any_eager(
+                *this,
+                static_cast<F&&>(func),
+                base_list {});
+        }
+        template <class F>
+        TUPLET_INLINE constexpr bool any_eager(F&& func) && {
+            return detail::_any_eager(
+                static_cast<tuple&&>(*this),
+                static_cast<F&&>(func),
+                base_list {});
+        }
+
+        // Like all, but always applies the function to every element, and
+        // combines the results with a bitwise and (see any_eager)
+        template <class F>
+        TUPLET_INLINE constexpr bool all_eager(F&& func) & {
+            return detail::_all_eager(
+                *this,
+                static_cast<F&&>(func),
+                base_list {});
+        }
+        template <class F>
+        TUPLET_INLINE constexpr bool all_eager(F&& func) const& {
+            return detail::_all_eager(
+                *this,
+                static_cast<F&&>(func),
+                base_list {});
+        }
+        template <class F>
+        TUPLET_INLINE constexpr bool all_eager(F&& func) && {
+            return detail::_all_eager(
+                static_cast<tuple&&>(*this),
+                static_cast<F&&>(func),
+                base_list {});
+        }
+
         // Map a function over every element in the tuple, using the values to
         // construct a new tuple
         template <class F>
@@ -963,6 +1207,149 @@ namespace tuplet {
                 base_list {});
         }
 
+        // Like map, but returns a view that applies the function to an
+        // element only when that element is read (see lazy_map_view).
+        // Chaining lazy_map composes the functions, so no intermediate tuple
+        // is ever built
+        template <class F>
+        TUPLET_INLINE constexpr auto lazy_map(F&& func) & {
+            return lazy_map_view<tuple&, std::decay_t<F>> {
+                *this,
+                static_cast<F&&>(func)};
+        }
+        template <class F>
+        TUPLET_INLINE constexpr auto lazy_map(F&& func) const& {
+            return lazy_map_view<tuple const&, std::decay_t<F>> {
+                *this,
+                static_cast<F&&>(func)};
+        }
+        template <class F>
+        TUPLET_INLINE constexpr auto lazy_map(F&& func) && {
+            return lazy_map_view<tuple, std::decay_t<F>> {
+                static_cast<tuple&&>(*this),
+                static_cast<F&&>(func)};
+        }
+
+        // Combines every element with a binary function, as a balanced tree:
+        // for four elements, reduce(op) is op(op(a, b), op(c, d)). Partial
+        // results don't depend on each other, so the CPU can compute them in
+        // parallel, unlike in a fold expression, which is a chain N - 1
+        // calls long. op must be associative, and floating-point results may
+        // differ from a left fold's in the last bits
+        template <class Op>
+        TUPLET_INLINE constexpr auto reduce(Op&& op) & {
+            return detail::_reduce(*this, op);
+        }
+        template <class Op>
+        TUPLET_INLINE constexpr auto reduce(Op&& op) const& {
+            return detail::_reduce(*this, op);
+        }
+        template <class Op>
+        TUPLET_INLINE constexpr auto reduce(Op&& op) && {
+            return detail::_reduce(static_cast<tuple&&>(*this), op);
+        }
+
+        // Returns a tuple of elements I..., in the order they're listed:
+        // tup.select<3, 0>() is {get<3>(tup), get<0>(tup)}. Elements are
+        // copied, or moved out of an rvalue tuple (in which case no index
+        // should be listed twice). To view elements without copying them,
+        // use tie_select
+        template <size_t... I>
+        TUPLET_INLINE constexpr auto select() const& {
+            return tuple<decltype(decl_elem(tag<I>()))...> {
+                (*this)[tag<I>()]...};
+        }
+        template <size_t... I>
+        TUPLET_INLINE constexpr auto select() && {
+            return tuple<decltype(decl_elem(tag<I>()))...> {
+                static_cast<tuple&&>(*this)[tag<I>()]...};
+        }
+
+        // For tuples whose elements are laid out like an array (every
+        // element has the same type, with no padding in between), returns a
+        // pointer to element 0. The other elements follow it, so data()[i]
+        // is element i
+        TUPLET_INLINE constexpr auto* data() noexcept {
+            static_assert(
+                detail::_is_array_like<tuple>,
+                "Runtime indexing requires elements of the same type, laid "
+                "out like an array");
+            return &(*this)[tag<0>()];
+        }
+        TUPLET_INLINE constexpr auto* data() const noexcept {
+            static_assert(
+                detail::_is_array_like<tuple>,
+                "Runtime indexing requires elements of the same type, laid "
+                "out like an array");
+            return &(*this)[tag<0>()];
+        }
+
+        // Element i of a tuple laid out like an array (see data), where i is
+        // only known at run time. As when indexing an array, i isn't checked
+        TUPLET_INLINE auto& operator[](size_t i) noexcept { return data()[i]; }
+        TUPLET_INLINE auto& operator[](size_t i) const noexcept {
+            return data()[i];
+        }
+
+        // Like for_each, but each application of the function is a separate
+        // task on the given pool, so elements may be visited concurrently,
+        // and in any order. Returns once every task has finished. The pool
+        // can be any type with a fork_join(tasks...) member, such as
+        // tuplet::thread_pool (see <tuplet/thread_pool.hpp>)
+        template <class Pool, class F>
+        void parallel_for_each(Pool& pool, F&& func) & {
+            detail::_parallel_for_each(
+                pool,
+                *this,
+                static_cast<F&&>(func),
+                base_list {});
+        }
+        template <class Pool, class F>
+        void parallel_for_each(Pool& pool, F&& func) const& {
+            detail::_parallel_for_each(
+                pool,
+                *this,
+                static_cast<F&&>(func),
+                base_list {});
+        }
+        template <class Pool, class F>
+        void parallel_for_each(Pool& pool, F&& func) && {
+            detail::_parallel_for_each(
+                pool,
+                static_cast<tuple&&>(*this),
+                static_cast<F&&>(func),
+                base_list {});
+        }
+
+        // Like map, but each application of the function is a separate task
+        // on the given pool. Results are stored in place until every task
+        // has finished, and then moved into the returned tuple, so results
+        // are in declaration order regardless of which task finished first
+        template <class Pool, class F>
+        auto parallel_map(Pool& pool, F&& func) & {
+            return detail::_parallel_map(
+                pool,
+                *this,
+                static_cast<F&&>(func),
+                base_list {});
+        }
+        template <class Pool, class F>
+        auto parallel_map(Pool& pool, F&& func) const& {
+            return detail::_parallel_map(
+                pool,
+                *this,
+                static_cast<F&&>(func),
+                base_list {});
+        }
+        template <class Pool, class F>
+        auto parallel_map(Pool& pool, F&& func) && {
+            return detail::_parallel_map(
+                pool,
+                static_cast<tuple&&>(*this),
+                static_cast<F&&>(func),
+                base_list {});
+        }
+
         template <class F>
         TUPLET_INLINE constexpr decltype(auto) apply(F&& func) & {
             return detail::_apply(*this, static_cast<F&&>(func), base_list {});
@@ -1123,6 +1510,18 @@ namespace tuplet {
             return true;
         }
 
+        // (Returns false for empty tuple)
+        template <class F>
+        constexpr bool any_eager(F&&) const noexcept {
+            return false;
+        }
+
+        // (Returns true for empty tuple)
+        template <class F>
+        constexpr bool all_eager(F&&) const noexcept {
+            return true;
+        }
+
         // Map a function over every element in the tuple, using the values to
         // construct a new tuple
         //
@@ -1132,6 +1531,22 @@ namespace tuplet {
             return tuple {};
         }
 
+        // (The view is empty too, and never calls the function)
+        template <class F>
+        constexpr auto lazy_map(F&& func) const {
+            return lazy_map_view<tuple, std::decay_t<F>> {
+                {},
+                static_cast<F&&>(func)};
+        }
+
+        template <class Pool, class F>
+        void parallel_for_each(Pool&, F&&) const noexcept {}
+
+        template <class Pool, class F>
+        auto parallel_map(Pool&, F&&) const noexcept {
+            return tuple {};
+        }
+
         template <class F>
         constexpr decltype(auto) apply(F&& func) const noexcept {
             return func();
@@ -1280,16 +1695,125 @@ namespace tuplet {
 
 
 
+///////////////////////////////////////////////
+////  tuplet::lazy_map_view: deferred map  ////
+///////////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// Applies f, then g, to the same element
+    template <class F, class G>
+    struct _composed {
+        TUPLET_NO_UNIQUE_ADDRESS F f;
+        TUPLET_NO_UNIQUE_ADDRESS G g;
+
+        template <class X>
+        TUPLET_INLINE constexpr decltype(auto) operator()(X&& x) {
+            return g(f(static_cast<X&&>(x)));
+        }
+        template <class X>
+        TUPLET_INLINE constexpr decltype(auto) operator()(X&& x) const {
+            return g(f(static_cast<X&&>(x)));
+        }
+    };
+} // namespace tuplet::detail
+
+namespace tuplet {
+    // A tuple with a function applied to each element, returned by
+    // tuple::lazy_map. Element I is func(get<I>(tuple)), which is computed
+    // each time it's read, with tuplet::get<I> or view[tag<I>()]. Tuple is
+    // a reference to the viewed tuple, or, if lazy_map was called on an
+    // rvalue, the tuple itself. Views of a reference must not outlive it.
+    // As with map, func may be a mutable lambda, in which case elements can
+    // only be read from a non-const view
+    template <class Tuple, class F>
+    struct lazy_map_view {
+        constexpr static size_t N = std::decay_t<Tuple>::N;
+        Tuple tuple;
+        TUPLET_NO_UNIQUE_ADDRESS F func;
+
+        template <size_t I>
+        TUPLET_INLINE constexpr decltype(auto) operator[](tag<I> i) & {
+            return func(tuple[i]);
+        }
+        template <size_t I>
+        TUPLET_INLINE constexpr decltype(auto) operator[](tag<I> i) const& {
+            return func(tuple[i]);
+        }
+        template <size_t I>
+        TUPLET_INLINE constexpr decltype(auto) operator[](tag<I> i) && {
+            return func(static_cast<Tuple&&>(tuple)[i]);
+        }
+
+        // Returns a view of the same tuple that applies func, then g
+        template <class G>
+        TUPLET_INLINE constexpr auto lazy_map(G&& g) const& {
+            using composed = detail::_composed<F, std::decay_t<G>>;
+            return lazy_map_view<Tuple, composed> {
+                tuple,
+                composed {func, static_cast<G&&>(g)}};
+        }
+        template <class G>
+        TUPLET_INLINE constexpr auto lazy_map(G&& g) && {
+            using composed = detail::_composed<F, std::decay_t<G>>;
+            return lazy_map_view<Tuple, composed> {
+                static_cast<Tuple&&>(tuple),
+                composed {static_cast<F&&>(func), static_cast<G&&>(g)}};
+        }
+
+        // Computes every element, and returns them as a tuple. Each result
+        // is constructed directly in the returned tuple, as with map
+        TUPLET_INLINE constexpr auto materialize() & {
+            return detail::_map(tuple, func, _base_list {});
+        }
+        TUPLET_INLINE constexpr auto materialize() const& {
+            return detail::_map(tuple, func, _base_list {});
+        }
+        TUPLET_INLINE constexpr auto materialize() && {
+            return detail::_map(
+                static_cast<Tuple&&>(tuple),
+                func,
+                _base_list {});
+        }
+
+      private:
+        // Not exposed as base_list, since the view has no tuple_elem bases,
+        // and functions that take a base_list_tuple access elements through
+        // them
+        using _base_list = typename std::decay_t<Tuple>::base_list;
+    };
+} // namespace tuplet
+
+namespace tuplet::detail {
+    template <class Tuple, class F>
+    constexpr bool _is_lazy_map_view<lazy_map_view<Tuple, F>> = true;
+
+    /// Calls func with every element of a view, each computed as it's
+    /// passed
+    template <class View, class F, size_t... I>
+    TUPLET_INLINE constexpr decltype(auto) _apply_view(
+        View&& view,
+        F&& func,
+        std::index_sequence<I...>) {
+        return static_cast<F&&>(func)(static_cast<View&&>(view)[tag<I>()]...);
+    }
+} // namespace tuplet::detail
+
+
+
+
+
 /////////////////////////////////////////////////////////
 ////  tuplet Appendix 1: Small non-member functions  ////
 /////////////////////////////////////////////////////////
 
 // tuplet::get implementation
 // tuplet::tie implementation
+// tuplet::tie_select
 // tuplet::apply implementation
 // tuplet::swap
 // tuplet::make_tuple
 // tuplet::forward_as_tuple
+// tuplet::reduce, min, max, argmin, argmax
 namespace tuplet {
     template <size_t I, TUPLET_WEAK_CONCEPT(indexable) Tup>
     TUPLET_INLINE constexpr decltype(auto) get(Tup&& tup) {
@@ -1301,6 +1825,15 @@ namespace tuplet {
         return {t...};
     }
 
+    // Returns a tuple of references to elements I... of tup, in the order
+    // they're listed, like tie(get<I>(tup)...). Comparing or hashing these
+    // views compares or hashes part of a tuple without copying it
+    template <size_t... I, TUPLET_WEAK_CONCEPT(indexable) Tup>
+    TUPLET_INLINE constexpr auto tie_select(Tup& tup)
+        -> tuple<decltype(tup[tag<I>()])...> {
+        return {tup[tag<I>()]...};
+    }
+
     template <class F, TUPLET_WEAK_CONCEPT(base_list_tuple) Tup>
     TUPLET_INLINE constexpr decltype(auto) apply(F&& func, Tup&& tup) {
         return detail::_apply(
@@ -1328,6 +1861,36 @@ namespace tuplet {
         return static_cast<F&&>(
             func)(static_cast<P>(pair).first, static_cast<P>(pair).second);
     }
+    template <class F, class Tuple, class G>
+    TUPLET_INLINE constexpr decltype(auto) apply(
+        F&& func,
+        lazy_map_view<Tuple, G>& view) {
+        using V = lazy_map_view<Tuple, G>;
+        return detail::_apply_view(
+            view,
+            static_cast<F&&>(func),
+            tag_range<V::N>());
+    }
+    template <class F, class Tuple, class G>
+    TUPLET_INLINE constexpr decltype(auto) apply(
+        F&& func,
+        lazy_map_view<Tuple, G> const& view) {
+        using V = lazy_map_view<Tuple, G>;
+        return detail::_apply_view(
+            view,
+            static_cast<F&&>(func),
+            tag_range<V::N>());
+    }
+    template <class F, class Tuple, class G>
+    TUPLET_INLINE constexpr decltype(auto) apply(
+        F&& func,
+        lazy_map_view<Tuple, G>&& view) {
+        using V = lazy_map_view<Tuple, G>;
+        return detail::_apply_view(
+            static_cast<V&&>(view),
+            static_cast<F&&>(func),
+            tag_range<V::N>());
+    }
 
     template <class... T>
     TUPLET_INLINE void swap(tuple<T...>& a, tuple<T...>& b) noexcept(
@@ -1350,6 +1913,65 @@ namespace tuplet {
     TUPLET_INLINE constexpr auto forward_as_tuple(T&&... a) noexcept {
         return tuple<T&&...> {static_cast<T&&>(a)...};
     }
+
+    // Combines init with every element of the tuple, as a balanced tree
+    // (see tuple::reduce). Returns op(init, tup.reduce(op)), or init when
+    // the tuple is empty
+    template <class Init, class Op, class... T>
+    TUPLET_INLINE constexpr auto reduce(
+        tuple<T...> const& tup,
+        Init init,
+        Op op) {
+        if constexpr (sizeof...(T) == 0) {
+            return init;
+        } else {
+            return op(static_cast<Init&&>(init), detail::_reduce(tup, op));
+        }
+    }
+
+    // Smallest element of a non-empty homogeneous tuple (the first one, if
+    // several are equal). Compares elements in a balanced tree
+    template <class T, class... U>
+    TUPLET_INLINE constexpr auto min(tuple<T, U...> const& tup) {
+        static_assert(
+            detail::_is_homogeneous<T, U...>,
+            "tuplet::min requires every element to have the same type");
+        auto op = [](auto const& a, auto const& b) { return b < a ? b : a; };
+        return detail::_reduce(tup, op);
+    }
+
+    // Largest element of a non-empty homogeneous tuple (the first one, if
+    // several are equal)
+    template <class T, class... U>
+    TUPLET_INLINE constexpr auto max(tuple<T, U...> const& tup) {
+        static_assert(
+            detail::_is_homogeneous<T, U...>,
+            "tuplet::max requires every element to have the same type");
+        auto op = [](auto const& a, auto const& b) { return a < b ? b : a; };
+        return detail::_reduce(tup, op);
+    }
+
+    // Index of the smallest element of a non-empty homogeneous tuple (the
+    // lowest index, if several are equal)
+    template <class T, class... U>
+    TUPLET_INLINE constexpr size_t argmin(tuple<T, U...> const& tup) {
+        static_assert(
+            detail::_is_homogeneous<T, U...>,
+            "tuplet::argmin requires every element to have the same type");
+        auto less = [](auto const& a, auto const& b) { return a < b; };
+        return detail::_select(tup, less).index;
+    }
+
+    // Index of the largest element of a non-empty homogeneous tuple (the
+    // lowest index, if several are equal)
+    template <class T, class... U>
+    TUPLET_INLINE constexpr size_t argmax(tuple<T, U...> const& tup) {
+        static_assert(
+            detail::_is_homogeneous<T, U...>,
+            "tuplet::argmax requires every element to have the same type");
+        auto greater = [](auto const& a, auto const& b) { return b < a; };
+        return detail::_select(tup, greater).index;
+    }
 } // namespace tuplet
 
 
@@ -1360,6 +1982,25 @@ namespace tuplet {
 ////  tuplet Appendix 2: The Horror that is tuple_cat  ////
 ///////////////////////////////////////////////////////////
 
+namespace tuplet {
+    /// Strategy used by tuple_cat to collect its arguments before building
+    /// the result. See bench/bench-tuple-cat.cpp for measurements.
+    enum class cat_strategy {
+        /// Choose based on the element types. If TUPLET_CAT_BY_FORWARDING_TUPLE
+        /// is defined, it's used instead.
+        automatic,
+        /// Collect references to the arguments, then copy or move each element
+        /// directly into the result. Each element is moved or copied exactly
+        /// once.
+        by_forwarding_tuple,
+        /// Collect the arguments by value, then move each element into the
+        /// result. This costs an extra move per element, but gives the
+        /// compiler a single value to work with, which produces better code
+        /// for trivially copyable elements.
+        by_value,
+    };
+} // namespace tuplet
+
 namespace tuplet::detail {
     template <class T, class... Q>
     TUPLET_INLINE constexpr auto _repeat_type(type_list<Q...>) {
@@ -1387,36 +2028,142 @@ namespace tuplet::detail {
             TUPLET_GET_M(Outer, tup, value),
             value)...};
     }
+
+    template <class... T>
+    constexpr bool _trivially_copyable(type_list<T...>) {
+#if _MSC_VER
+        return ::tuplet::sfinae::detail::_all_true<
+            std::is_trivially_copyable_v<T>...>();
+#else
+        return (std::is_trivially_copyable_v<T> && ...);
+#endif
+    }
+
+    /// Determines if tuple_cat should use a forwarding tuple for the given
+    /// strategy and arguments.
+    ///
+    /// With cat_strategy::automatic, elements that are all trivially copyable
+    /// are collected by value: the extra move is just a copy of bytes that the
+    /// optimizer can merge away, and Clang produces better assembly this way.
+    /// Anything else (references, move-only types, or types that own
+    /// resources) is forwarded, so that each element is only moved or copied
+    /// once.
+    ///
+    /// See: https://github.com/codeinred/tuplet/discussions/14
+    template <cat_strategy Strategy, class... T>
+    constexpr bool _cat_by_forwarding_tuple() {
+        if constexpr (Strategy == cat_strategy::automatic) {
+#if defined(TUPLET_CAT_BY_FORWARDING_TUPLE)
+            return TUPLET_CAT_BY_FORWARDING_TUPLE;
+#else
+            return !(_trivially_copyable(element_list_t<T> {}) && ...);
+#endif
+        } else {
+            return Strategy == cat_strategy::by_forwarding_tuple;
+        }
+    }
+
+    /// A forwarding reference to a tuple, or to a member inside one. Left
+    /// folding | over a path of bases walks down it one level at a time,
+    /// like TUPLET_FWD_M applied once per base. Each step depends only on
+    /// one tuple type and one base, so leaves that share a prefix share the
+    /// instantiations for it
+    template <class T>
+    struct _fwd_ref {
+        T&& value;
+
+        TUPLET_INLINE constexpr T&& forward() const {
+            return static_cast<T&&>(value);
+        }
+    };
+    template <class T, class B>
+    TUPLET_INLINE constexpr auto operator|(_fwd_ref<T> ref, type_list<B>)
+        -> _fwd_ref<decltype((TUPLET_FWD_M(T, B, ref.value, value)))> {
+        return {TUPLET_FWD_M(T, B, ref.value, value)};
+    }
+
+    /// A leaf of a nested tuple, with type T, reached through bases B...
+    template <class T, class... B>
+    struct _leaf_path {
+        using type = T;
+
+        template <class Tup>
+        TUPLET_INLINE constexpr static decltype(auto) get(Tup&& tup) {
+            return (_fwd_ref<Tup> {static_cast<Tup&&>(tup)} | ...
+                    | type_list<B> {})
+                .forward();
+        }
+    };
+
+    template <class... Prefix, class... B>
+    constexpr auto _leaf_paths(type_list<Prefix...>, type_list<B...>);
+
+    /// Elements that are tuples (but not references to tuples) are expanded
+    /// into their leaves. Everything else is a leaf
+    template <class B, class... Prefix>
+    constexpr auto _leaf_paths_of() {
+        if constexpr (_is_tuple<type_t<B>>) {
+            return _leaf_paths(
+                type_list<Prefix..., B> {},
+                base_list_t<type_t<B>> {});
+        } else {
+            return type_list<_leaf_path<type_t<B>, Prefix..., B>> {};
+        }
+    }
+
+    /// Paths to every leaf below the bases B..., in declaration order
+    template <class... Prefix, class... B>
+    constexpr auto _leaf_paths(type_list<Prefix...>, type_list<B...>) {
+        return (type_list<> {} + ... + _leaf_paths_of<B, Prefix...>());
+    }
+
+    template <class Tup>
+    using _leaf_paths_t = decltype(_leaf_paths(
+        type_list<> {},
+        base_list_t<Tup> {}));
+
+    /// tuple_cat materializes lazy_map views, and forwards everything else
+    template <class T>
+    TUPLET_INLINE constexpr decltype(auto) _cat_operand(T&& tup) {
+        if constexpr (_is_lazy_map_view<std::decay_t<T>>) {
+            return static_cast<T&&>(tup).materialize();
+        } else {
+            return static_cast<T&&>(tup);
+        }
+    }
+
+    template <class... Leaf>
+    auto _flatten_type(type_list<Leaf...>) -> tuple<typename Leaf::type...>;
+
+    template <class Tup, class... Leaf>
+    TUPLET_INLINE constexpr auto _flatten(Tup&& tup, type_list<Leaf...>)
+        -> tuple<typename Leaf::type...> {
+        return {Leaf::get(static_cast<Tup&&>(tup))...};
+    }
 } // namespace tuplet::detail
 
 namespace tuplet {
-    template <TUPLET_WEAK_CONCEPT(base_list_tuple)... T>
+    /// Concatenates the given tuples. The strategy used to collect the
+    /// arguments is chosen by the element types, but it can be overridden for
+    /// a single call, eg:
+    ///
+    ///     tuplet::tuple_cat<tuplet::cat_strategy::by_value>(a, b)
+    template <
+        cat_strategy Strategy = cat_strategy::automatic,
+        TUPLET_WEAK_CONCEPT(cat_operand)... T>
     constexpr auto tuple_cat(T&&... ts) {
         if constexpr (sizeof...(T) == 0) {
             return tuple<>();
+        } else if constexpr (
+            (detail::_is_lazy_map_view<std::decay_t<T>> || ...)) {
+            // The materialized views live until this call returns
+            return tuple_cat<Strategy>(
+                detail::_cat_operand(static_cast<T&&>(ts))...);
         } else {
-
-/**
- * It appears that Clang produces better assembly when
- * TUPLET_CAT_BY_FORWARDING_TUPLE == 0, while GCC produces better assembly when
- * TUPLET_CAT_BY_FORWARDING_TUPLE == 1. MSVC always produces terrible assembly
- * in either case. This will set TUPLET_CAT_BY_FORWARDING_TUPLE to the correct
- * value (0 for clang, 1 for everyone else)
- *
- * See: https://github.com/codeinred/tuplet/discussions/14
- */
-#if !defined(TUPLET_CAT_BY_FORWARDING_TUPLE)
-#if defined(__clang__)
-#define TUPLET_CAT_BY_FORWARDING_TUPLE 0
-#else
-#define TUPLET_CAT_BY_FORWARDING_TUPLE 1
-#endif
-#endif
-#if TUPLET_CAT_BY_FORWARDING_TUPLE
-            using big_tuple = tuple<T&&...>;
-#else
-            using big_tuple = tuple<std::decay_t<T>...>;
-#endif
+            using big_tuple = std::conditional_t<
+                detail::_cat_by_forwarding_tuple<Strategy, T...>(),
+                tuple<T&&...>,
+                tuple<std::decay_t<T>...>>;
             using outer_bases = base_list_t<big_tuple>;
             constexpr auto outer = detail::_get_outer_bases(outer_bases {});
             constexpr auto inner = detail::_get_inner_bases(outer_bases {});
@@ -1427,6 +2174,26 @@ namespace tuplet {
         }
     }
 
+    /// The tuple with the leaves of a nested tuple as its elements, in
+    /// order: flatten_t<tuple<tuple<A, B>, C, tuple<D, tuple<E>>>> is
+    /// tuple<A, B, C, D, E>. Only elements that are tuplet::tuples are
+    /// expanded, so references to tuples are kept as they are, and empty
+    /// tuples disappear
+    template <class Tuple>
+    using flatten_t = decltype(detail::_flatten_type(
+        detail::_leaf_paths_t<std::decay_t<Tuple>> {}));
+
+    /// Returns a single-level tuple holding the leaves of a nested tuple (see
+    /// flatten_t). Each leaf is forwarded straight from where it is in tup
+    /// to where it goes in the result, so if tup is an rvalue, every leaf
+    /// is moved exactly once
+    template <TUPLET_WEAK_CONCEPT(base_list_tuple) Tup>
+    TUPLET_INLINE constexpr auto flatten(Tup&& tup) {
+        return detail::_flatten(
+            static_cast<Tup&&>(tup),
+            detail::_leaf_paths_t<std::decay_t<Tup>> {});
+    }
+
 
 } // namespace tuplet
 
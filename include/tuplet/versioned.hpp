@@ -0,0 +1,251 @@
+#ifndef TUPLET_VERSIONED_HPP_IMPLEMENTATION
+#define TUPLET_VERSIONED_HPP_IMPLEMENTATION
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <tuplet/cacheline.hpp>
+#include <utility>
+#include <vector>
+
+
+
+
+
+/////////////////////////////////////////////
+////  tuplet::detail: Epoch Bookkeeping  ////
+/////////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// Epoch announced by a reader while it's pinned. Each slot gets its own
+    /// cache line, since it's written on every pin by its reader, and read
+    /// by writers
+    struct alignas(cache_line_size) _reader_slot {
+        constexpr static uint64_t idle = UINT64_MAX;
+
+        std::atomic<uint64_t> epoch {idle};
+        /// Set while a reader handle owns the slot. Guarded by the mutex of
+        /// the versioned object
+        bool in_use = false;
+    };
+
+    /// A version that has been replaced, and can be deleted once every
+    /// reader pinned at or before its epoch has unpinned
+    template <class T>
+    struct _retired {
+        T const* value;
+        uint64_t epoch;
+    };
+} // namespace tuplet::detail
+
+
+
+
+
+////////////////////////////////
+////  tuplet::versioned<T>  ////
+////////////////////////////////
+
+namespace tuplet {
+    /// Holds the current version of a value (typically a container, such as
+    /// a std::vector of tuples), which readers access without locks while
+    /// writers replace it.
+    ///
+    /// Writers build a new version and publish it by swapping a pointer.
+    /// Readers pin the current version with epoch-based reclamation: each
+    /// reader has a slot where it announces the epoch it pinned in, and a
+    /// replaced version is deleted once no reader is pinned in an epoch
+    /// that could still see it. Pinning is a store to the reader's own slot
+    /// followed by a fence; there are no read-modify-write operations on
+    /// shared data on the read path, so readers never contend with each
+    /// other, and never wait for writers.
+    ///
+    ///     tuplet::versioned<std::vector<route>> routes(load_routes());
+    ///     auto reader = routes.reader();  // once per thread
+    ///     {
+    ///         auto table = reader.pin();
+    ///         lookup(*table, address);
+    ///     }
+    ///     routes.update([](auto& table) { table.push_back(new_route); });
+    ///
+    /// Writers are serialized with a mutex. A version is only deleted by a
+    /// writer (or the destructor), never by a reader.
+    template <class T>
+    class versioned {
+        using slot_t = detail::_reader_slot;
+
+       public:
+        class reader_handle;
+
+        /// A pinned version. The version stays alive until the pin is
+        /// destroyed. Pins should be short-lived, since a pinned reader
+        /// delays the reclamation of every version replaced after it
+        class pinned {
+           public:
+            pinned(pinned const&) = delete;
+            pinned& operator=(pinned const&) = delete;
+
+            ~pinned() {
+                _slot->epoch.store(slot_t::idle, std::memory_order_release);
+            }
+
+            T const& operator*() const noexcept { return *_value; }
+            T const* operator->() const noexcept { return _value; }
+            T const* get() const noexcept { return _value; }
+
+           private:
+            friend class reader_handle;
+            pinned(slot_t* slot, T const* value) noexcept
+              : _slot(slot)
+              , _value(value) {}
+
+            slot_t* _slot;
+            T const* _value;
+        };
+
+        /// Registers a reader with a versioned object. A reader handle
+        /// belongs to one thread, and only one version can be pinned through
+        /// it at a time. Handles are cheap to keep around, but creating one
+        /// takes a lock, so create one per thread rather than per read.
+        class reader_handle {
+           public:
+            reader_handle(reader_handle&& other) noexcept
+              : _owner(std::exchange(other._owner, nullptr))
+              , _slot(other._slot) {}
+            reader_handle& operator=(reader_handle&&) = delete;
+
+            ~reader_handle() {
+                if (_owner) {
+                    _owner->_release_slot(_slot);
+                }
+            }
+
+            /// Pins the current version
+            pinned pin() const noexcept {
+                uint64_t epoch = _owner->_epoch.load(std::memory_order_acquire);
+                _slot->epoch.store(epoch, std::memory_order_relaxed);
+                // Pairs with the fence in _reclaim(): either the writer sees
+                // this slot, or this load sees the version it published
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                return {_slot, _owner->_current.load(std::memory_order_acquire)};
+            }
+
+           private:
+            friend class versioned;
+            reader_handle(versioned* owner, slot_t* slot) noexcept
+              : _owner(owner)
+              , _slot(slot) {}
+
+            versioned* _owner;
+            slot_t* _slot;
+        };
+
+        versioned()
+          : versioned(T {}) {}
+        explicit versioned(T value)
+          : _current(new T(static_cast<T&&>(value))) {}
+
+        versioned(versioned const&) = delete;
+        versioned& operator=(versioned const&) = delete;
+
+        /// Every reader handle must be gone by the time this is called
+        ~versioned() {
+            delete _current.load(std::memory_order_relaxed);
+            for (auto& retired : _retired) {
+                delete retired.value;
+            }
+        }
+
+        reader_handle reader() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto& slot : _slots) {
+                if (!slot->in_use) {
+                    slot->in_use = true;
+                    return {this, slot.get()};
+                }
+            }
+            _slots.push_back(std::make_unique<slot_t>());
+            _slots.back()->in_use = true;
+            return {this, _slots.back().get()};
+        }
+
+        /// Replaces the current version with value
+        void publish(T value) {
+            auto* next = new T(static_cast<T&&>(value));
+            std::lock_guard<std::mutex> lock(_mutex);
+            _replace(next);
+        }
+
+        /// Publishes a copy of the current version, modified by func.
+        /// Concurrent updates are serialized, so none of them are lost
+        template <class F>
+        void update(F&& func) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto next = std::make_unique<T>(
+                *_current.load(std::memory_order_relaxed));
+            static_cast<F&&>(func)(*next);
+            _replace(next.release());
+        }
+
+        /// Deletes replaced versions that no reader can see anymore. This
+        /// happens on every publish, so it's only needed to free memory
+        /// sooner when there are no more updates
+        void reclaim() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _reclaim();
+        }
+
+        /// Number of replaced versions that haven't been deleted yet
+        size_t retired_count() const {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _retired.size();
+        }
+
+       private:
+        void _replace(T const* next) {
+            T const* previous = _current.exchange(
+                next,
+                std::memory_order_acq_rel);
+            // Readers that pin after seeing the new epoch also see the new
+            // version
+            uint64_t epoch = _epoch.load(std::memory_order_relaxed);
+            _retired.push_back({previous, epoch});
+            _epoch.store(epoch + 1, std::memory_order_release);
+            _reclaim();
+        }
+
+        void _reclaim() {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            uint64_t oldest = slot_t::idle;
+            for (auto& slot : _slots) {
+                uint64_t epoch = slot->epoch.load(std::memory_order_acquire);
+                oldest = epoch < oldest ? epoch : oldest;
+            }
+            // A reader pinned in epoch E may have seen any version retired
+            // in epoch E or later
+            size_t kept = 0;
+            for (auto& retired : _retired) {
+                if (retired.epoch < oldest) {
+                    delete retired.value;
+                } else {
+                    _retired[kept++] = retired;
+                }
+            }
+            _retired.resize(kept);
+        }
+
+        void _release_slot(slot_t* slot) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            slot->in_use = false;
+        }
+
+        std::atomic<T const*> _current;
+        std::atomic<uint64_t> _epoch {0};
+        mutable std::mutex _mutex;
+        std::vector<std::unique_ptr<slot_t>> _slots;
+        std::vector<detail::_retired<T>> _retired;
+    };
+} // namespace tuplet
+#endif
@@ -0,0 +1,254 @@
+#ifndef TUPLET_WHEN_ALL_HPP_IMPLEMENTATION
+#define TUPLET_WHEN_ALL_HPP_IMPLEMENTATION
+
+#include <tuplet/tuple.hpp>
+
+#if __cpp_impl_coroutine
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+
+
+
+
+////////////////////////////////////////////
+////  tuplet::detail: when_all Details  ////
+////////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// Obtains the awaiter for an awaitable, the same way co_await does
+    template <class A>
+    decltype(auto) _get_awaiter(A&& awaitable) {
+        if constexpr (requires {
+                          static_cast<A&&>(awaitable).operator co_await();
+                      }) {
+            return static_cast<A&&>(awaitable).operator co_await();
+        } else if constexpr (requires {
+                                 operator co_await(
+                                     static_cast<A&&>(awaitable));
+                             }) {
+            return operator co_await(static_cast<A&&>(awaitable));
+        } else {
+            return static_cast<A&&>(awaitable);
+        }
+    }
+
+    template <class A>
+    using _await_result_t = decltype(_get_awaiter(std::declval<A>())
+                                         .await_resume());
+
+    /// Results of awaitables that return void are stored as empty tuples
+    template <class A>
+    using _when_all_value_t = std::conditional_t<
+        std::is_void_v<_await_result_t<A>>,
+        tuple<>,
+        _await_result_t<A>>;
+
+    struct _forward_fn {
+        template <class T>
+        T&& operator()(T&& value) const noexcept {
+            return static_cast<T&&>(value);
+        }
+    };
+
+    /// Shared by the children of a when_all. It starts at the number of
+    /// children plus one, so that the parent can't be resumed before it has
+    /// finished starting every child
+    struct _when_all_counter {
+        std::atomic<size_t> remaining;
+        std::coroutine_handle<> parent {};
+
+        /// Called as each child finishes. Returns the parent if this was the
+        /// last child, so that it can be resumed by symmetric transfer
+        std::coroutine_handle<> finish() noexcept {
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                return parent;
+            }
+            return std::noop_coroutine();
+        }
+    };
+
+    /// Inline storage for the frame of a child coroutine
+    template <size_t Capacity>
+    struct _child_frame {
+        alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) unsigned char bytes[Capacity];
+    };
+
+    /// Space reserved for the frame of the child awaiting A. The frame holds
+    /// the awaiter and the result, plus bookkeeping that depends on the
+    /// compiler; frames that don't fit are allocated on the heap instead
+    template <class A>
+    constexpr size_t _child_frame_capacity =
+        128 + sizeof(_when_all_value_t<A>)
+        + sizeof(std::remove_reference_t<decltype(_get_awaiter(
+            std::declval<A>()))>);
+
+    /// Coroutine awaiting a single awaitable of a when_all. Its frame lives
+    /// in a _child_frame inside the when_all when it fits, and it stays
+    /// suspended at its final suspend point until the when_all destroys it
+    template <size_t Capacity>
+    struct _when_all_child {
+        struct promise_type {
+            _when_all_counter& counter;
+            std::exception_ptr& error;
+
+            template <class... Args>
+            promise_type(
+                _child_frame<Capacity>&,
+                _when_all_counter& counter,
+                std::exception_ptr& error,
+                Args&&...) noexcept
+              : counter(counter)
+              , error(error) {}
+
+            template <class... Args>
+            static void* operator new(
+                size_t size,
+                _child_frame<Capacity>& frame,
+                Args&&...) {
+                if (size <= Capacity) {
+                    return frame.bytes;
+                }
+                return ::operator new(size);
+            }
+            static void operator delete(void* ptr, size_t size) noexcept {
+                if (size > Capacity) {
+                    ::operator delete(ptr);
+                }
+            }
+
+            struct final_awaiter {
+                bool await_ready() noexcept { return false; }
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> child) noexcept {
+                    return child.promise().counter.finish();
+                }
+                void await_resume() noexcept {}
+            };
+
+            _when_all_child get_return_object() noexcept {
+                return {std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            final_awaiter final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept {
+                error = std::current_exception();
+            }
+        };
+
+        std::coroutine_handle<> handle;
+    };
+
+    template <size_t Capacity, class A, class Slot>
+    _when_all_child<Capacity> _when_all_run(
+        _child_frame<Capacity>&,
+        _when_all_counter&,
+        std::exception_ptr&,
+        A&& awaitable,
+        Slot& slot) {
+        _forward_fn forward;
+        if constexpr (std::is_void_v<_await_result_t<A>>) {
+            co_await static_cast<A&&>(awaitable);
+            slot.emplace(forward, tuple<> {});
+        } else {
+            slot.emplace(forward, co_await static_cast<A&&>(awaitable));
+        }
+    }
+
+    template <class Indices, class... A>
+    class _when_all_awaitable;
+
+    template <size_t... I, class... A>
+    class _when_all_awaitable<std::index_sequence<I...>, A...> {
+        constexpr static size_t N = sizeof...(A);
+        constexpr static size_t _array_size = N == 0 ? 1 : N;
+
+        // Lvalue awaitables are stored as references, and rvalue awaitables
+        // are moved in
+        tuple<A...> _awaitables;
+        _result_slots<_result_slot<tag<I>, _when_all_value_t<A>>...> _results;
+        tuple<_child_frame<_child_frame_capacity<A>>...> _frames;
+        std::exception_ptr _errors[_array_size] {};
+        std::coroutine_handle<> _children[_array_size] {};
+        _when_all_counter _counter {N + 1};
+
+       public:
+        explicit _when_all_awaitable(A&&... awaitables)
+          : _awaitables {static_cast<A&&>(awaitables)...} {}
+
+        _when_all_awaitable(_when_all_awaitable const&) = delete;
+
+        ~_when_all_awaitable() {
+            for (std::coroutine_handle<> child : _children) {
+                if (child) {
+                    child.destroy();
+                }
+            }
+        }
+
+        bool await_ready() const noexcept { return N == 0; }
+
+        bool await_suspend(std::coroutine_handle<> parent) {
+            _counter.parent = parent;
+            // Create every child before starting any, so that if allocating
+            // a frame fails, no child is left running
+            ((_children[I] = _when_all_run(
+                  tuplet::get<I>(_frames),
+                  _counter,
+                  _errors[I],
+                  static_cast<A&&>(tuplet::get<I>(_awaitables)),
+                  _slot_for<tag<I>>(_results))
+                                 .handle),
+             ...);
+            for (std::coroutine_handle<> child : _children) {
+                child.resume();
+            }
+            // If every child already finished, continue without suspending
+            return _counter.remaining.fetch_sub(1, std::memory_order_acq_rel)
+                != 1;
+        }
+
+        tuple<_when_all_value_t<A>...> await_resume() {
+            for (std::exception_ptr const& error : _errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+            return {_slot_for<tag<I>>(_results).take()...};
+        }
+    };
+} // namespace tuplet::detail
+
+
+
+
+
+////////////////////////////
+////  tuplet::when_all  ////
+////////////////////////////
+
+namespace tuplet {
+    /// Awaits every awaitable concurrently, producing a tuplet::tuple of
+    /// their results in argument order (void results become tuple<>).
+    ///
+    /// The returned awaitable holds the results in place, so when it's
+    /// awaited directly, they live in the frame of the awaiting coroutine.
+    /// Each awaitable is awaited by a small child coroutine, whose frame is
+    /// also stored in the awaitable when it fits. The last child to finish
+    /// resumes the awaiting coroutine; the only synchronization is a single
+    /// atomic counter. If any awaitable throws,
+    /// the first exception (in argument order) is rethrown once all of them
+    /// have finished.
+    template <class... A>
+    auto when_all(A&&... awaitables) {
+        return detail::_when_all_awaitable<std::index_sequence_for<A...>, A...>(
+            static_cast<A&&>(awaitables)...);
+    }
+} // namespace tuplet
+#endif
+#endif
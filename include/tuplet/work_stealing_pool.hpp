@@ -0,0 +1,308 @@
+#ifndef TUPLET_WORK_STEALING_POOL_HPP_IMPLEMENTATION
+#define TUPLET_WORK_STEALING_POOL_HPP_IMPLEMENTATION
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+
+
+
+//////////////////////////////////////////////////////
+////  tuplet::detail: Work Stealing Pool Details  ////
+//////////////////////////////////////////////////////
+
+namespace tuplet::detail {
+    /// A unit of work for a work_stealing_pool. Jobs are small and trivially
+    /// copyable, so they can be queued without allocating
+    struct _steal_job {
+        void (*run)(void* data, size_t arg);
+        void* data;
+        size_t arg;
+    };
+
+    /// Tracks a group of jobs that someone is waiting on
+    struct _steal_join {
+        std::atomic<size_t> remaining;
+        std::atomic<bool> failed {false};
+        std::exception_ptr error {};
+
+        explicit _steal_join(size_t count) noexcept
+          : remaining(count) {}
+
+        /// Records the exception currently being handled, unless another
+        /// job in the group already failed. Must be called before the job
+        /// calls finish()
+        void fail() noexcept {
+            if (!failed.exchange(true, std::memory_order_relaxed)) {
+                error = std::current_exception();
+            }
+        }
+
+        /// Returns true if this was the last job in the group
+        bool finish() noexcept {
+            return remaining.fetch_sub(1, std::memory_order_seq_cst) == 1;
+        }
+
+        bool done() const noexcept {
+            return remaining.load(std::memory_order_seq_cst) == 0;
+        }
+    };
+
+    /// Double ended queue of jobs. The worker that owns it pushes and pops
+    /// at the back, so it works on the most recently spawned (and most
+    /// likely cache-hot) jobs first, while thieves take the oldest jobs from
+    /// the front. Each queue has its own mutex: workers almost always touch
+    /// only their own queue, so the mutex is rarely contended. The buffer
+    /// only grows, so a pool that has warmed up doesn't allocate.
+    class _job_deque {
+       public:
+        void push_back(_steal_job job) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_size == _ring.size()) {
+                _grow();
+            }
+            _ring[(_head + _size) & (_ring.size() - 1)] = job;
+            _size++;
+        }
+
+        bool pop_back(_steal_job& job) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_size == 0) {
+                return false;
+            }
+            _size--;
+            job = _ring[(_head + _size) & (_ring.size() - 1)];
+            return true;
+        }
+
+        bool pop_front(_steal_job& job) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_size == 0) {
+                return false;
+            }
+            job = _ring[_head];
+            _head = (_head + 1) & (_ring.size() - 1);
+            _size--;
+            return true;
+        }
+
+       private:
+        void _grow() {
+            std::vector<_steal_job> ring(_ring.empty() ? 64 : _ring.size() * 2);
+            for (size_t i = 0; i < _size; i++) {
+                ring[i] = _ring[(_head + i) & (_ring.size() - 1)];
+            }
+            _ring.swap(ring);
+            _head = 0;
+        }
+
+        std::mutex _mutex;
+        std::vector<_steal_job> _ring;
+        size_t _head = 0;
+        size_t _size = 0;
+    };
+} // namespace tuplet::detail
+
+
+
+
+
+//////////////////////////////////////
+////  tuplet::work_stealing_pool  ////
+//////////////////////////////////////
+
+namespace tuplet {
+    /// A thread pool where each worker has its own queue of jobs. Jobs
+    /// spawned by a worker go on that worker's queue, and idle workers steal
+    /// from the queues of others. Like tuplet::thread_pool, threads that
+    /// wait on jobs run jobs themselves while they wait.
+    class work_stealing_pool {
+       public:
+        work_stealing_pool()
+          : work_stealing_pool(
+              std::thread::hardware_concurrency() > 1
+                  ? std::thread::hardware_concurrency() - 1
+                  : 0) {}
+
+        /// Jobs submitted from threads outside the pool go in an extra
+        /// queue, which every worker steals from
+        explicit work_stealing_pool(size_t worker_count)
+          : _queues(worker_count + 1) {
+            _workers.reserve(worker_count);
+            for (size_t i = 0; i < worker_count; i++) {
+                _workers.emplace_back([this, i] { _work(i); });
+            }
+        }
+
+        work_stealing_pool(work_stealing_pool const&) = delete;
+        work_stealing_pool& operator=(work_stealing_pool const&) = delete;
+
+        ~work_stealing_pool() {
+            _stopping.store(true);
+            _wake_all();
+            for (auto& worker : _workers) {
+                worker.join();
+            }
+        }
+
+        /// Number of worker threads (not counting threads waiting on jobs)
+        size_t size() const noexcept { return _workers.size(); }
+
+        /// Runs every task, possibly in parallel, and returns once all of
+        /// them have finished. If any task throws, the first exception is
+        /// rethrown after the remaining tasks have finished.
+        template <class... F>
+        void fork_join(F&&... tasks) {
+            if constexpr (sizeof...(F) != 0) {
+                detail::_steal_join join {sizeof...(F)};
+                _fork_join_task items[] {_fork_join_task {
+                    std::addressof(tasks),
+                    &_call<std::remove_reference_t<F>>,
+                    &join,
+                    this}...};
+                for (size_t i = 1; i < sizeof...(F); i++) {
+                    submit({&_run_fork_join_task, &items[i], 0});
+                }
+                // Run the first task here rather than waiting for a worker
+                _run_fork_join_task(&items[0], 0);
+                wait(join);
+            }
+        }
+
+        /// Queues a job. Jobs submitted from a worker of this pool go on
+        /// that worker's own queue.
+        void submit(detail::_steal_job job) {
+            // Counted before it's queued, so that _pending never underflows
+            // when the job is taken right away
+            _pending.fetch_add(1, std::memory_order_seq_cst);
+            _queues[_current_queue()].push_back(job);
+            if (_sleepers.load(std::memory_order_seq_cst) != 0) {
+                _wake_one();
+            }
+        }
+
+        /// Runs jobs until every job in the group has finished, then
+        /// rethrows the first exception thrown by a job in the group (if
+        /// any)
+        void wait(detail::_steal_join& join) {
+            detail::_steal_job job;
+            while (!join.done()) {
+                if (_find_job(_current_queue(), job)) {
+                    job.run(job.data, job.arg);
+                    continue;
+                }
+                _sleep([&] { return join.done(); });
+            }
+            if (join.failed.load(std::memory_order_relaxed)) {
+                std::rethrow_exception(join.error);
+            }
+        }
+
+        /// Marks one job of the group as finished, waking any thread
+        /// waiting on the group if it was the last one
+        void finish(detail::_steal_join& join) {
+            if (join.finish() && _sleepers.load(std::memory_order_seq_cst)) {
+                _wake_all();
+            }
+        }
+
+       private:
+        struct _fork_join_task {
+            void* func;
+            void (*call)(void*);
+            detail::_steal_join* join;
+            work_stealing_pool* pool;
+        };
+
+        template <class F>
+        static void _call(void* func) {
+            (*static_cast<F*>(func))();
+        }
+
+        static void _run_fork_join_task(void* data, size_t) {
+            auto& task = *static_cast<_fork_join_task*>(data);
+            try {
+                task.call(task.func);
+            } catch (...) {
+                task.join->fail();
+            }
+            task.pool->finish(*task.join);
+        }
+
+        /// The pool and queue of the current thread, if it's a worker.
+        /// Zero initialized for every other thread
+        struct _worker_id {
+            work_stealing_pool const* pool;
+            size_t queue;
+        };
+        inline static thread_local _worker_id _current;
+
+        size_t _current_queue() const noexcept {
+            return _current.pool == this ? _current.queue : _workers.size();
+        }
+
+        /// Takes a job from our own queue, or steals one from another
+        bool _find_job(size_t own, detail::_steal_job& job) {
+            bool found = _queues[own].pop_back(job);
+            for (size_t i = 1; !found && i < _queues.size(); i++) {
+                found = _queues[(own + i) % _queues.size()].pop_front(job);
+            }
+            if (found) {
+                _pending.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return found;
+        }
+
+        /// Blocks until a job is queued, the pool is stopping, or done()
+        /// returns true. Either the sleeper sees the update to _pending, or
+        /// the thread queuing the job sees the sleeper and wakes it
+        template <class Done>
+        void _sleep(Done done) {
+            std::unique_lock<std::mutex> lock(_sleep_mutex);
+            _sleepers.fetch_add(1, std::memory_order_seq_cst);
+            _wake.wait(lock, [&] {
+                return _pending.load(std::memory_order_seq_cst) != 0
+                    || _stopping.load() || done();
+            });
+            _sleepers.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void _wake_one() {
+            { std::lock_guard<std::mutex> lock(_sleep_mutex); }
+            _wake.notify_one();
+        }
+        void _wake_all() {
+            { std::lock_guard<std::mutex> lock(_sleep_mutex); }
+            _wake.notify_all();
+        }
+
+        void _work(size_t queue) {
+            _current = {this, queue};
+            detail::_steal_job job;
+            while (!_stopping.load()) {
+                if (_find_job(queue, job)) {
+                    job.run(job.data, job.arg);
+                } else {
+                    _sleep([] { return false; });
+                }
+            }
+        }
+
+        std::vector<detail::_job_deque> _queues;
+        std::atomic<size_t> _pending {0};
+        std::atomic<size_t> _sleepers {0};
+        std::atomic<bool> _stopping {false};
+        std::mutex _sleep_mutex;
+        std::condition_variable _wake;
+        std::vector<std::thread> _workers;
+    };
+} // namespace tuplet
+#endif
@@ -0,0 +1,372 @@
+#ifndef TUPLET_ZIP_HPP_IMPLEMENTATION
+#define TUPLET_ZIP_HPP_IMPLEMENTATION
+
+#include <cstddef>
+#include <iterator>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+
+
+
+
+/////////////////////////////////////////
+////  tuplet::detail: Zip Iterators  ////
+/////////////////////////////////////////
+
+namespace tuplet::detail {
+    template <class R, class = void>
+    constexpr bool _is_contiguous = false;
+
+    /// Ranges with std::data() and std::size() store their elements
+    /// contiguously (arrays, std::vector, std::array, std::string, spans...)
+    template <class R>
+    constexpr bool _is_contiguous<
+        R,
+        std::void_t<
+            decltype(std::data(std::declval<R&>())),
+            decltype(std::size(std::declval<R&>()))>> = true;
+
+    template <class R, class = void>
+    constexpr bool _has_size = false;
+
+    template <class R>
+    constexpr bool _has_size<
+        R,
+        std::void_t<decltype(std::size(std::declval<R&>()))>> = true;
+
+    template <class R>
+    using _iterator_t = decltype(std::begin(std::declval<R&>()));
+
+    template <class R>
+    using _pointer_t = decltype(std::data(std::declval<R&>()));
+
+    /// Iterator over contiguous ranges. It holds a pointer to the start of
+    /// each range, and a single index: advancing the iterator only
+    /// increments the index, and comparisons only look at the index, so a
+    /// loop over a zip compiles to the same loop as one written by hand with
+    /// an index (and can be vectorized the same way). It has the operations
+    /// of a random access iterator, but like _zip_iterator, it's tagged as
+    /// an input iterator, since reference is a tuple of references returned
+    /// by value
+    template <class... P>
+    class _zip_index_iterator {
+        tuple<P...> _data;
+        ptrdiff_t _index = 0;
+
+       public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = tuple<std::remove_cv_t<
+            std::remove_reference_t<decltype(*std::declval<P>())>>...>;
+        using reference = tuple<decltype(*std::declval<P>())...>;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+
+        _zip_index_iterator() = default;
+        constexpr _zip_index_iterator(tuple<P...> data, ptrdiff_t index)
+          : _data(data)
+          , _index(index) {}
+
+        constexpr reference operator*() const {
+            return _data.map(
+                [i = _index](auto p) -> decltype(auto) { return p[i]; });
+        }
+        constexpr reference operator[](ptrdiff_t n) const {
+            return *(*this + n);
+        }
+
+        constexpr _zip_index_iterator& operator++() {
+            ++_index;
+            return *this;
+        }
+        constexpr _zip_index_iterator operator++(int) {
+            auto copy = *this;
+            ++_index;
+            return copy;
+        }
+        constexpr _zip_index_iterator& operator--() {
+            --_index;
+            return *this;
+        }
+        constexpr _zip_index_iterator operator--(int) {
+            auto copy = *this;
+            --_index;
+            return copy;
+        }
+        constexpr _zip_index_iterator& operator+=(ptrdiff_t n) {
+            _index += n;
+            return *this;
+        }
+        constexpr _zip_index_iterator& operator-=(ptrdiff_t n) {
+            _index -= n;
+            return *this;
+        }
+        friend constexpr _zip_index_iterator operator+(
+            _zip_index_iterator it,
+            ptrdiff_t n) {
+            return it += n;
+        }
+        friend constexpr _zip_index_iterator operator+(
+            ptrdiff_t n,
+            _zip_index_iterator it) {
+            return it += n;
+        }
+        friend constexpr _zip_index_iterator operator-(
+            _zip_index_iterator it,
+            ptrdiff_t n) {
+            return it -= n;
+        }
+        friend constexpr ptrdiff_t operator-(
+            _zip_index_iterator const& a,
+            _zip_index_iterator const& b) {
+            return a._index - b._index;
+        }
+
+        friend constexpr bool operator==(
+            _zip_index_iterator const& a,
+            _zip_index_iterator const& b) {
+            return a._index == b._index;
+        }
+        friend constexpr bool operator!=(
+            _zip_index_iterator const& a,
+            _zip_index_iterator const& b) {
+            return a._index != b._index;
+        }
+        friend constexpr bool operator<(
+            _zip_index_iterator const& a,
+            _zip_index_iterator const& b) {
+            return a._index < b._index;
+        }
+        friend constexpr bool operator>(
+            _zip_index_iterator const& a,
+            _zip_index_iterator const& b) {
+            return a._index > b._index;
+        }
+        friend constexpr bool operator<=(
+            _zip_index_iterator const& a,
+            _zip_index_iterator const& b) {
+            return a._index <= b._index;
+        }
+        friend constexpr bool operator>=(
+            _zip_index_iterator const& a,
+            _zip_index_iterator const& b) {
+            return a._index >= b._index;
+        }
+    };
+
+    /// True if any iterator in a equals the iterator at the same position
+    /// in b
+    template <class... I, size_t... K>
+    constexpr bool _any_equal(
+        tuple<I...> const& a,
+        tuple<I...> const& b,
+        std::index_sequence<K...>) {
+        return ((tuplet::get<K>(a) == tuplet::get<K>(b)) || ...);
+    }
+
+    /// Iterator over ranges of any kind, holding one iterator per range.
+    /// Two iterators compare equal if any of their underlying iterators are
+    /// equal, so iteration stops at the end of the shortest range. It's
+    /// only an input iterator: reference is a tuple of references returned
+    /// by value, and forward iterators must return value_type&
+    template <class... I>
+    class _zip_iterator {
+        tuple<I...> _its;
+
+       public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = tuple<
+            typename std::iterator_traits<I>::value_type...>;
+        using reference = tuple<
+            typename std::iterator_traits<I>::reference...>;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+
+        _zip_iterator() = default;
+        constexpr explicit _zip_iterator(tuple<I...> its)
+          : _its(static_cast<tuple<I...>&&>(its)) {}
+
+        constexpr reference operator*() const {
+            return _its.map([](auto const& it) -> decltype(auto) {
+                return *it;
+            });
+        }
+
+        constexpr _zip_iterator& operator++() {
+            _its.for_each([](auto& it) { ++it; });
+            return *this;
+        }
+        constexpr _zip_iterator operator++(int) {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend constexpr bool operator==(
+            _zip_iterator const& a,
+            _zip_iterator const& b) {
+            return _any_equal(
+                a._its,
+                b._its,
+                std::index_sequence_for<I...> {});
+        }
+        friend constexpr bool operator!=(
+            _zip_iterator const& a,
+            _zip_iterator const& b) {
+            return !(a == b);
+        }
+    };
+
+    template <bool Contiguous, class... R>
+    struct _zip_iterator_for {
+        using type = _zip_index_iterator<_pointer_t<R>...>;
+    };
+    template <class... R>
+    struct _zip_iterator_for<false, R...> {
+        using type = _zip_iterator<_iterator_t<R>...>;
+    };
+
+    template <class... R>
+    constexpr size_t _min_size(R&... ranges) {
+        size_t sizes[] {size_t(std::size(ranges))...};
+        size_t min = sizes[0];
+        for (size_t size : sizes) {
+            min = size < min ? size : min;
+        }
+        return min;
+    }
+
+    template <class F, class... P>
+    constexpr void _zip_for_each_index(F& func, size_t size, P... data) {
+        for (size_t i = 0; i < size; i++) {
+            func(data[i]...);
+        }
+    }
+
+    template <class F, class... I>
+    constexpr void _zip_for_each_iterator(
+        F& func,
+        tuple<I...> its,
+        tuple<I...> const& ends) {
+        while (!_any_equal(its, ends, std::index_sequence_for<I...> {})) {
+            its.apply([&](I const&... it) { func(*it...); });
+            its.for_each([](auto& it) { ++it; });
+        }
+    }
+} // namespace tuplet::detail
+
+
+
+
+
+////////////////////////////////////////////////
+////  tuplet::zip and tuplet::zip_for_each  ////
+////////////////////////////////////////////////
+
+namespace tuplet {
+    /// A view over several ranges at once. Dereferencing an iterator gives a
+    /// tuple of references to the elements at the same position in each
+    /// range (as if by tuplet::tie), and iteration stops at the end of the
+    /// shortest range. Lvalue ranges are referenced, and rvalue ranges are
+    /// moved into the view.
+    ///
+    /// When every range is contiguous, iterators are a set of pointers plus
+    /// a single index, so loops over a zip vectorize like a loop over an
+    /// index would.
+    template <class... R>
+    class zip_view {
+        static_assert(sizeof...(R) > 0, "zip requires at least one range");
+
+        tuple<R...> _ranges;
+
+       public:
+        constexpr static bool contiguous = (detail::_is_contiguous<R> && ...);
+
+        using iterator =
+            typename detail::_zip_iterator_for<contiguous, R...>::type;
+        /// Ranges owned by the view are const in a const view, while ranges
+        /// it references keep their constness
+        using const_iterator =
+            typename detail::_zip_iterator_for<contiguous, R const...>::type;
+
+        constexpr explicit zip_view(R&&... ranges)
+          : _ranges {static_cast<R&&>(ranges)...} {}
+
+        constexpr iterator begin() {
+            if constexpr (contiguous) {
+                return iterator(
+                    _ranges.map([](auto& r) { return std::data(r); }),
+                    0);
+            } else {
+                return iterator(
+                    _ranges.map([](auto& r) { return std::begin(r); }));
+            }
+        }
+        constexpr const_iterator begin() const {
+            if constexpr (contiguous) {
+                return const_iterator(
+                    _ranges.map([](auto& r) { return std::data(r); }),
+                    0);
+            } else {
+                return const_iterator(
+                    _ranges.map([](auto& r) { return std::begin(r); }));
+            }
+        }
+
+        constexpr iterator end() {
+            if constexpr (contiguous) {
+                return iterator(
+                    _ranges.map([](auto& r) { return std::data(r); }),
+                    ptrdiff_t(size()));
+            } else {
+                return iterator(
+                    _ranges.map([](auto& r) { return std::end(r); }));
+            }
+        }
+        constexpr const_iterator end() const {
+            if constexpr (contiguous) {
+                return const_iterator(
+                    _ranges.map([](auto& r) { return std::data(r); }),
+                    ptrdiff_t(size()));
+            } else {
+                return const_iterator(
+                    _ranges.map([](auto& r) { return std::end(r); }));
+            }
+        }
+
+        /// Size of the shortest range
+        template <
+            bool HasSize = (detail::_has_size<R> && ...),
+            class = std::enable_if_t<HasSize>>
+        constexpr size_t size() const {
+            return _ranges.apply(
+                [](auto&... r) { return detail::_min_size(r...); });
+        }
+    };
+
+    template <class... R>
+    constexpr zip_view<R...> zip(R&&... ranges) {
+        return zip_view<R...>(static_cast<R&&>(ranges)...);
+    }
+
+    /// Calls func with the elements at each position of the given ranges,
+    /// stopping at the end of the shortest range. Unlike iterating over
+    /// zip(ranges...), this never builds a tuple of references.
+    template <class F, class... R>
+    constexpr void zip_for_each(F&& func, R&&... ranges) {
+        static_assert(sizeof...(R) > 0, "zip_for_each requires a range");
+        if constexpr ((detail::_is_contiguous<R> && ...)) {
+            detail::_zip_for_each_index(
+                func,
+                detail::_min_size(ranges...),
+                std::data(ranges)...);
+        } else {
+            detail::_zip_for_each_iterator(
+                func,
+                tuple<detail::_iterator_t<R>...> {std::begin(ranges)...},
+                tuple<detail::_iterator_t<R>...> {std::end(ranges)...});
+        }
+    }
+} // namespace tuplet
+#endif
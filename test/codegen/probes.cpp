@@ -0,0 +1,55 @@
+// Probe functions for the codegen regression test. This file is compiled to
+// assembly (not linked), and cmake/check_codegen.cmake inspects the output
+// for each probe_* symbol.
+//
+// Every probe is extern "C" so that its label in the assembly is predictable.
+#include <cstdint>
+#include <tuplet/sort.hpp>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+using tuplet::get;
+
+using pair_t = tuplet::tuple<int, int>;
+using row_t = tuplet::tuple<int8_t, int8_t, int16_t, int32_t>;
+using float4_t = tuplet::tuple<float, float, float, float>;
+using int4_t = tuplet::tuple<int, int, int, int>;
+
+extern "C" {
+// tuple<int, int> should be passed in a single register
+int probe_pass_tuple(pair_t tup) { return get<0>(tup) + get<1>(tup); }
+
+// tuple<int, int> should be returned in a single register
+pair_t probe_return_tuple(int a, int b) { return {a, b}; }
+
+// get should compile down to a plain load, with no calls
+double probe_get(tuplet::tuple<int, long, double> const& tup) {
+    return get<2>(tup);
+}
+
+// Copying a vector of trivially copyable tuples should lower to memcpy (or
+// memmove), rather than an element-by-element copy
+void probe_copy_vector(std::vector<row_t> const& src, std::vector<row_t>& dest) {
+    dest = src;
+}
+
+// apply should be fully inlined
+int probe_apply(tuplet::tuple<int, int, int> tup) {
+    return tuplet::apply([](int a, int b, int c) { return a * b + c; }, tup);
+}
+
+// tuple_cat of small trivial tuples should be fully inlined
+pair_t probe_tuple_cat(tuplet::tuple<int> a, tuplet::tuple<int> b) {
+    return tuplet::tuple_cat(a, b);
+}
+
+// Sorting numbers should compile to a sorting network with no branches:
+// min/max or cmov for each comparator
+void probe_sort_ints(int4_t& tup) { tuplet::sort_elements(tup); }
+
+void probe_sort_floats(float4_t& tup) { tuplet::sort_elements(tup); }
+
+void probe_sort_floats_descending(float4_t& tup) {
+    tuplet::sort_elements(tup, std::greater<>());
+}
+}
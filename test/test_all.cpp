@@ -28,3 +28,22 @@ TEST_CASE("Test tup.all() with move", "[test-all]") {
     REQUIRE(std::move(tup).all(is_valid_move));
     REQUIRE_FALSE(tup.all(is_valid_ref));
 }
+
+TEST_CASE("Test tup.all_eager()", "[test-all]") {
+    using tuplet::tuple;
+
+    auto tup = tuple {1, 2, 3, 4.3, 5};
+    REQUIRE(tup.all_eager([](auto val) { return val < 10; }));
+    REQUIRE_FALSE(tup.all_eager([](auto val) { return val < 4; }));
+    REQUIRE(tuple {}.all_eager([](auto) { return false; }));
+    STATIC_REQUIRE_FALSE(
+        tuple {1, 2}.all_eager([](int val) { return val == 2; }));
+
+    int calls = 0;
+    REQUIRE_FALSE(tup.all_eager([&](auto val) {
+        calls++;
+        return val > 1;
+    }));
+    INFO("all() would stop after the first element");
+    REQUIRE(calls == 5);
+}
@@ -30,3 +30,27 @@ TEST_CASE("Test tup.any() with move", "[test-any]") {
     REQUIRE(std::move(tup).any(is_valid_move));
     REQUIRE_FALSE(tup.any(is_valid_ref));
 }
+
+TEST_CASE("Test tup.any_eager()", "[test-any]") {
+    using tuplet::tuple;
+
+    auto tup = tuple {1, 2, 3, 4.3, 5};
+    REQUIRE(tup.any_eager([](auto val) { return val < 10; }));
+    REQUIRE(tup.any_eager([](auto val) { return val > 4; }));
+    REQUIRE_FALSE(tup.any_eager([](auto val) { return val < 0; }));
+    REQUIRE_FALSE(tuple {}.any_eager([](auto) { return true; }));
+    STATIC_REQUIRE(tuple {1, 2}.any_eager([](int val) { return val == 2; }));
+}
+
+TEST_CASE("Test tup.any_eager() visits every element", "[test-any]") {
+    using tuplet::tuple;
+
+    auto tup = tuple {1, 2, 3, 4};
+    int calls = 0;
+    REQUIRE(tup.any_eager([&](int val) {
+        calls++;
+        return val == 1;
+    }));
+    INFO("any() would stop after the first element");
+    REQUIRE(calls == 4);
+}
@@ -0,0 +1,135 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <tuplet/atomic.hpp>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+using tuplet::atomic_tuple;
+using tuplet::get;
+using tuplet::tuple;
+
+TEST_CASE("atomic_tuple loads and stores whole tuples", "[atomic]") {
+    atomic_tuple<uint32_t, uint32_t, uint64_t> value;
+    REQUIRE(value.load() == tuple<uint32_t, uint32_t, uint64_t> {0, 0, 0});
+
+    value.store({1, 2, 3});
+    REQUIRE(value.load() == tuple<uint32_t, uint32_t, uint64_t> {1, 2, 3});
+
+    auto previous = value.exchange({4, 5, 6});
+    REQUIRE(previous == tuple<uint32_t, uint32_t, uint64_t> {1, 2, 3});
+    REQUIRE(value.load() == tuple<uint32_t, uint32_t, uint64_t> {4, 5, 6});
+}
+
+TEST_CASE("atomic_tuple uses an 8-byte word for small tuples", "[atomic]") {
+    STATIC_REQUIRE(atomic_tuple<uint16_t, uint32_t>::is_always_lock_free);
+    STATIC_REQUIRE(atomic_tuple<char, char, char>::is_always_lock_free);
+    STATIC_REQUIRE(
+        atomic_tuple<uint32_t, uint64_t>::is_always_lock_free
+        == (TUPLET_HAS_DOUBLE_WIDTH_CAS == 1));
+
+    atomic_tuple<char, char, char> chars({'a', 'b', 'c'});
+    REQUIRE(chars.load() == tuple<char, char, char> {'a', 'b', 'c'});
+}
+
+TEST_CASE("atomic_tuple compare_exchange ignores padding", "[atomic]") {
+    // Three bytes of padding after the first element, and two after the
+    // third
+    using padded = tuple<uint8_t, uint32_t, uint16_t, uint32_t>;
+    atomic_tuple<uint8_t, uint32_t, uint16_t, uint32_t> value({1, 2, 3, 4});
+
+    // Fill the padding of expected with garbage
+    padded expected;
+    std::memset(&expected, 0xab, sizeof(expected));
+    get<0>(expected) = 1;
+    get<1>(expected) = 2;
+    get<2>(expected) = 3;
+    get<3>(expected) = 4;
+
+    REQUIRE(value.compare_exchange_strong(expected, {5, 6, 7, 8}));
+    REQUIRE(value.load() == padded {5, 6, 7, 8});
+
+    padded stale {1, 2, 3, 4};
+    REQUIRE(!value.compare_exchange_strong(stale, {9, 9, 9, 9}));
+    REQUIRE(stale == padded {5, 6, 7, 8});
+
+    // Weak compare-exchange may fail spuriously, so retry
+    while (!value.compare_exchange_weak(stale, {9, 9, 9, 9})) {
+    }
+    REQUIRE(value.load() == padded {9, 9, 9, 9});
+}
+
+TEST_CASE("atomic_tuple fetch_add only changes one element", "[atomic]") {
+    atomic_tuple<uint32_t, int32_t, uint64_t> value({10, -1, 100});
+    REQUIRE(value.fetch_add<0>(5) == 10);
+    REQUIRE(value.fetch_sub<1>(2) == -1);
+    REQUIRE(value.fetch_add<2>(1) == 100);
+    REQUIRE(value.load() == tuple<uint32_t, int32_t, uint64_t> {15, -3, 101});
+
+    REQUIRE(value.fetch_update<2>([](uint64_t x) { return x * 2; }) == 101);
+    REQUIRE(get<2>(value.load()) == 202);
+}
+
+TEST_CASE("atomic_tuple updates are atomic across threads", "[atomic]") {
+    constexpr uint32_t iterations = 20000;
+    constexpr uint32_t thread_count = 4;
+    atomic_tuple<uint32_t, uint32_t, uint64_t> value;
+    std::atomic<bool> torn {false};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&] {
+            for (uint32_t i = 0; i < iterations; i++) {
+                // Keeps the invariant that the last element is the sum of
+                // the first two
+                auto current = value.load();
+                tuple<uint32_t, uint32_t, uint64_t> next;
+                do {
+                    auto [a, b, sum] = current;
+                    if (sum != uint64_t(a) + b) {
+                        torn = true;
+                    }
+                    next = {a + 1, b + 2, sum + 3};
+                } while (!value.compare_exchange_weak(current, next));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(!torn);
+    auto [a, b, sum] = value.load();
+    REQUIRE(a == iterations * thread_count);
+    REQUIRE(b == 2 * iterations * thread_count);
+    REQUIRE(sum == 3 * uint64_t(iterations) * thread_count);
+}
+
+TEST_CASE("atomic_tuple fetch_add is atomic across threads", "[atomic]") {
+    constexpr int iterations = 5000;
+    constexpr int thread_count = 4;
+    atomic_tuple<int32_t, int16_t, int64_t> value;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < iterations; i++) {
+                value.fetch_add<0>(1);
+                value.fetch_sub<1>(1);
+                value.fetch_add<2>(3);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(
+        value.load()
+        == tuple<int32_t, int16_t, int64_t> {
+            iterations * thread_count,
+            int16_t(-iterations * thread_count),
+            3 * iterations * thread_count});
+}
@@ -0,0 +1,141 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <tuplet/cacheline.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <vector>
+
+using tuplet::cache_line_size;
+using tuplet::cacheline_tuple;
+using tuplet::get;
+using tuplet::tuple;
+
+TEST_CASE("cacheline_tuple puts each element on its own line", "[cacheline]") {
+    using counters = cacheline_tuple<
+        std::atomic<uint64_t>,
+        std::atomic<uint64_t>,
+        std::atomic<uint32_t>>;
+    STATIC_REQUIRE(sizeof(counters) == 3 * cache_line_size);
+    STATIC_REQUIRE(alignof(counters) == cache_line_size);
+
+    counters c;
+    auto address = [](auto const& elem) {
+        return reinterpret_cast<uintptr_t>(&elem);
+    };
+    REQUIRE(address(get<0>(c)) % cache_line_size == 0);
+    REQUIRE(address(get<1>(c)) - address(get<0>(c)) == cache_line_size);
+    REQUIRE(address(get<2>(c)) - address(get<1>(c)) == cache_line_size);
+}
+
+TEST_CASE("cacheline_tuple supports the tuple API", "[cacheline]") {
+    using namespace tuplet::literals;
+    cacheline_tuple<int, std::string, double> tup(1, "two", 3.0);
+
+    STATIC_REQUIRE(std::is_same_v<decltype(get<1>(tup)), std::string&>);
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(get<1>(std::move(tup))), std::string&&>);
+    STATIC_REQUIRE(std::tuple_size_v<decltype(tup)> == 3);
+    STATIC_REQUIRE(
+        std::is_same_v<std::tuple_element_t<2, decltype(tup)>, double>);
+
+    REQUIRE(get<0>(tup) == 1);
+    REQUIRE(tup[1_tag] == "two");
+
+    auto& [a, b, c] = tup;
+    a = 10;
+    b += "!";
+    c *= 2;
+    REQUIRE(tup.snapshot() == tuple<int, std::string, double> {10, "two!", 6.0});
+
+    size_t count = 0;
+    tup.for_each([&](auto const&) { count++; });
+    REQUIRE(count == 3);
+
+    auto joined = tuplet::apply(
+        [](int x, std::string const& s, double y) {
+            return std::to_string(x) + s + std::to_string(int(y));
+        },
+        tup);
+    REQUIRE(joined == "10two!6");
+}
+
+TEST_CASE("cacheline_tuple copies from non-const lvalues", "[cacheline]") {
+    cacheline_tuple<int, std::string> a(1, "one");
+    cacheline_tuple<int, std::string> b(a);
+    REQUIRE(b.snapshot() == a.snapshot());
+
+    // A single-element tuple is still copied, not used to initialize the
+    // element
+    cacheline_tuple<int> c(5);
+    cacheline_tuple<int> d(c);
+    REQUIRE(get<0>(d) == 5);
+}
+
+TEST_CASE("cacheline_tuple rvalues move their elements", "[cacheline]") {
+    using strings = cacheline_tuple<std::string, std::string>;
+    strings tup(std::string(32, 'a'), std::string(32, 'b'));
+
+    std::vector<std::string> moved;
+    std::move(tup).for_each([&](auto&& s) {
+        STATIC_REQUIRE(std::is_same_v<decltype(s), std::string&&>);
+        moved.push_back(std::move(s));
+    });
+    REQUIRE(moved == std::vector<std::string> {
+                         std::string(32, 'a'), std::string(32, 'b')});
+    REQUIRE(get<0>(tup).empty());
+
+    strings tup2(std::string(32, 'c'), std::string(32, 'd'));
+    auto joined = tuplet::apply(
+        [](std::string&& x, std::string&& y) { return x + y; },
+        std::move(tup2));
+    REQUIRE(joined == std::string(32, 'c') + std::string(32, 'd'));
+
+    // References stay references
+    int i = 0;
+    cacheline_tuple<int&> refs(i);
+    std::move(refs).for_each([](int& x) { x = 7; });
+    REQUIRE(i == 7);
+}
+
+TEST_CASE("cacheline_tuple snapshots of atomics are dense", "[cacheline]") {
+    cacheline_tuple<std::atomic<uint64_t>, std::atomic<uint32_t>, char> c(
+        5,
+        6,
+        'x');
+    get<0>(c)++;
+    get<1>(c) += 2;
+
+    auto snapshot = c.snapshot();
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(snapshot), tuple<uint64_t, uint32_t, char>>);
+    REQUIRE(snapshot == tuple<uint64_t, uint32_t, char> {6, 8, 'x'});
+}
+
+TEST_CASE("cacheline_tuple counters from several threads", "[cacheline]") {
+    cacheline_tuple<
+        std::atomic<uint64_t>,
+        std::atomic<uint64_t>,
+        std::atomic<uint64_t>>
+        counters;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 1000; i++) {
+                counters.apply([&](auto&... counter) {
+                    int index = 0;
+                    ((index++ == t ? counter.fetch_add(1) : 0), ...);
+                });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(
+        counters.snapshot()
+        == tuple<uint64_t, uint64_t, uint64_t> {1000, 1000, 1000});
+}
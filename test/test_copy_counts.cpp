@@ -0,0 +1,224 @@
+#undef TUPLET_TRACE_COPIES
+#define TUPLET_TRACE_COPIES 1
+
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <string>
+#include <tuplet/counting.hpp>
+#include <tuplet/project.hpp>
+#include <tuplet/tuple.hpp>
+
+using tuplet::copy_counts;
+using tuplet::count_copies;
+using tuplet::tuple;
+
+// Large enough that copies can't hide in the small string buffer
+using buffer = tuplet::counting<std::string>;
+
+static_assert(
+    !std::is_trivially_copyable_v<buffer>,
+    "counting<T> should record copies when tracing is enabled");
+
+namespace {
+    buffer make_buffer(char c) { return std::string(64, c); }
+} // namespace
+
+TEST_CASE("count_copies counts copies, moves, and destructions", "[copy-counts]") {
+    buffer a = make_buffer('a');
+
+    copy_counts counts = count_copies([&] {
+        buffer b = a;
+        buffer c = std::move(b);
+    });
+
+    REQUIRE(counts.copies == 1);
+    REQUIRE(counts.moves == 1);
+    REQUIRE(counts.destructions == 2);
+}
+
+TEST_CASE("tuple_cat copy counts", "[copy-counts][tuple_cat]") {
+    using tuplet::cat_strategy;
+    tuple<buffer, buffer> t1 {make_buffer('a'), make_buffer('b')};
+    tuple<buffer> t2 {make_buffer('c')};
+
+    SECTION("by_forwarding_tuple moves each element of an rvalue once") {
+        copy_counts counts = count_copies([&] {
+            auto result = tuplet::tuple_cat<cat_strategy::by_forwarding_tuple>(
+                std::move(t1),
+                std::move(t2));
+        });
+        REQUIRE(counts == copy_counts {0, 3, 3});
+    }
+
+    SECTION("by_forwarding_tuple copies each element of an lvalue once") {
+        copy_counts counts = count_copies([&] {
+            auto result = tuplet::tuple_cat<cat_strategy::by_forwarding_tuple>(
+                t1,
+                t2);
+        });
+        REQUIRE(counts == copy_counts {3, 0, 3});
+    }
+
+    // The inputs are first moved (or copied) into a temporary tuple of
+    // tuples, and then moved again into the result
+    SECTION("by_value moves each element of an rvalue twice") {
+        copy_counts counts = count_copies([&] {
+            auto result = tuplet::tuple_cat<cat_strategy::by_value>(
+                std::move(t1),
+                std::move(t2));
+        });
+        REQUIRE(counts == copy_counts {0, 6, 6});
+    }
+
+    SECTION("by_value copies, then moves, each element of an lvalue") {
+        copy_counts counts = count_copies([&] {
+            auto result = tuplet::tuple_cat<cat_strategy::by_value>(t1, t2);
+        });
+        REQUIRE(counts == copy_counts {3, 3, 6});
+    }
+
+    SECTION("automatic strategy") {
+        copy_counts counts = count_copies([&] {
+            auto result = tuplet::tuple_cat(std::move(t1), std::move(t2));
+        });
+
+#if defined(TUPLET_CAT_BY_FORWARDING_TUPLE) && !TUPLET_CAT_BY_FORWARDING_TUPLE
+        REQUIRE(counts == copy_counts {0, 6, 6});
+#else
+        // counting<std::string> isn't trivially copyable, so elements are
+        // forwarded, and moved exactly once
+        REQUIRE(counts == copy_counts {0, 3, 3});
+#endif
+    }
+}
+
+TEST_CASE("flatten copy counts", "[copy-counts][flatten]") {
+    tuple<tuple<buffer, buffer>, buffer, tuple<tuple<buffer>>> tup {
+        tuple<buffer, buffer> {make_buffer('a'), make_buffer('b')},
+        make_buffer('c'),
+        tuple<tuple<buffer>> {tuple<buffer> {make_buffer('d')}}};
+
+    SECTION("flatten moves each leaf of an rvalue once") {
+        copy_counts counts = count_copies([&] {
+            auto result = tuplet::flatten(std::move(tup));
+        });
+        REQUIRE(counts == copy_counts {0, 4, 4});
+    }
+
+    SECTION("flatten copies each leaf of an lvalue once") {
+        copy_counts counts = count_copies([&] {
+            auto result = tuplet::flatten(tup);
+        });
+        REQUIRE(counts == copy_counts {4, 0, 4});
+    }
+}
+
+TEST_CASE("project copy counts", "[copy-counts][project]") {
+    tuple<buffer, int, buffer> a {make_buffer('a'), 1, make_buffer('b')};
+    tuple<buffer, int, buffer> b {make_buffer('a'), 2, make_buffer('c')};
+
+    SECTION("comparing by a projection doesn't copy") {
+        copy_counts counts = count_copies([&] {
+            auto equal = tuplet::project<0, 2>(std::equal_to<>());
+            REQUIRE_FALSE(equal(a, b));
+        });
+        REQUIRE(counts == copy_counts {});
+    }
+
+    SECTION("select copies the selected elements") {
+        copy_counts counts = count_copies([&] {
+            auto key = a.select<2, 0>();
+        });
+        REQUIRE(counts == copy_counts {2, 0, 2});
+    }
+}
+
+TEST_CASE("map copy counts", "[copy-counts][test-map]") {
+    tuple<buffer, buffer> tup {make_buffer('a'), make_buffer('b')};
+    auto forward = [](auto&& value) -> decltype(auto) {
+        return static_cast<decltype(value)&&>(value);
+    };
+    auto by_value = [](auto&& value) {
+        return std::decay_t<decltype(value)>(
+            static_cast<decltype(value)&&>(value));
+    };
+
+    SECTION("map returning references doesn't copy") {
+        copy_counts counts = count_copies([&] {
+            auto refs = tup.map(forward);
+            REQUIRE(&tuplet::get<0>(refs) == &tuplet::get<0>(tup));
+        });
+        REQUIRE(counts == copy_counts {});
+    }
+
+    SECTION("map of an rvalue constructs results in place") {
+        copy_counts counts = count_copies(
+            [&] { auto result = std::move(tup).map(by_value); });
+        REQUIRE(counts.copies == 0);
+        REQUIRE(counts.moves == 2);
+        REQUIRE(counts.destructions == 2);
+    }
+}
+
+TEST_CASE("lazy_map copy counts", "[copy-counts][lazy_map]") {
+    tuple<buffer, buffer> tup {make_buffer('a'), make_buffer('b')};
+    auto copy = [](buffer const& b) { return b; };
+    auto pass = [](buffer b) { return b; };
+
+    // The intermediate tuple's elements are moved into pass, and then
+    // destroyed along with it
+    SECTION("chained map builds an intermediate tuple") {
+        copy_counts counts = count_copies([&] {
+            auto result = tup.map(copy).map(pass);
+        });
+        REQUIRE(counts == copy_counts {2, 4, 6});
+    }
+
+    // The result of copy initializes pass's parameter directly
+    SECTION("chained lazy_map doesn't") {
+        copy_counts counts = count_copies([&] {
+            auto result = tup.lazy_map(copy).lazy_map(pass).materialize();
+        });
+        REQUIRE(counts == copy_counts {2, 2, 4});
+    }
+}
+
+TEST_CASE("as and convert copy counts", "[copy-counts][conversion]") {
+    tuple<buffer, buffer> tup {make_buffer('a'), make_buffer('b')};
+    using target = tuple<buffer, buffer>;
+
+    SECTION("as<U>() on an lvalue copies each element once") {
+        copy_counts counts = count_copies(
+            [&] { auto result = tup.as<target>(); });
+        REQUIRE(counts.copies == 2);
+        REQUIRE(counts.moves == 0);
+    }
+
+    SECTION("as<U>() on an rvalue moves each element once") {
+        copy_counts counts = count_copies(
+            [&] { auto result = std::move(tup).as<target>(); });
+        REQUIRE(counts.copies == 0);
+        REQUIRE(counts.moves == 2);
+    }
+
+    SECTION("explicit conversion of an rvalue moves each element once") {
+        copy_counts counts = count_copies(
+            [&] { auto result = static_cast<target>(std::move(tup)); });
+        REQUIRE(counts.copies == 0);
+        REQUIRE(counts.moves == 2);
+    }
+
+    SECTION("convert on an lvalue copies each element once") {
+        copy_counts counts = count_copies(
+            [&] { target result = tuplet::convert {tup}; });
+        REQUIRE(counts.copies == 2);
+        REQUIRE(counts.moves == 0);
+    }
+
+    SECTION("convert on an rvalue moves the tuple into the converter first") {
+        copy_counts counts = count_copies(
+            [&] { target result = tuplet::convert {std::move(tup)}; });
+        REQUIRE(counts.copies == 0);
+        REQUIRE(counts.moves == 4);
+    }
+}
@@ -0,0 +1,89 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <tuplet/elementwise.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+
+using tuplet::tuple;
+
+TEST_CASE("Elementwise operators combine tuples", "[elementwise]") {
+    using namespace tuplet::elementwise;
+    tuple<float, float, float, float> a {1, 2, 3, 4}, b {4, 3, 2, 1}, out;
+
+    out = a + b;
+    REQUIRE(out == tuple {5.f, 5.f, 5.f, 5.f});
+    out = a - b;
+    REQUIRE(out == tuple {-3.f, -1.f, 1.f, 3.f});
+    out = a * b;
+    REQUIRE(out == tuple {4.f, 6.f, 6.f, 4.f});
+    out = a / b;
+    REQUIRE(out == tuple {0.25f, 2.f / 3.f, 1.5f, 4.f});
+    out = min(a, b);
+    REQUIRE(out == tuple {1.f, 2.f, 2.f, 1.f});
+    out = max(a, b);
+    REQUIRE(out == tuple {4.f, 3.f, 3.f, 4.f});
+}
+
+TEST_CASE("Elementwise expressions chain with scalars", "[elementwise]") {
+    using namespace tuplet::elementwise;
+    tuple<float, float, float, float> a {1, 2, 3, 4}, b {0, 0, 5, -8};
+
+    // Clamp half the difference to [0, 1]
+    tuple<float, float, float, float> out = min(max((a - b) * 0.5f, 0), 1);
+    REQUIRE(out == tuple {0.5f, 1.f, 0.f, 1.f});
+
+    out = 10 - a * 2 + b / 2;
+    REQUIRE(out == tuple {8.f, 6.f, 6.5f, -2.f});
+}
+
+TEST_CASE("Elementwise expressions are lazy", "[elementwise]") {
+    using namespace tuplet::elementwise;
+    tuple<int32_t, int32_t, int32_t> a {1, 2, 3};
+
+    // Assigning an expression that reads the tuple being assigned: each
+    // element is computed from the elements of a before it's overwritten
+    a = a * a + 1;
+    REQUIRE(a == tuple<int32_t, int32_t, int32_t> {2, 5, 10});
+
+    // Nothing is computed until the expression is evaluated
+    auto expr = a + 1;
+    a = tuple<int32_t, int32_t, int32_t> {0, 0, 0};
+    REQUIRE(eval(expr) == tuple {1, 1, 1});
+}
+
+TEST_CASE("Elementwise expressions assign through tie", "[elementwise]") {
+    using namespace tuplet::elementwise;
+    tuple<int, int> a {1, 2};
+    int x = 0, y = 0;
+
+    tuplet::tie(x, y) = a * 10 + 1;
+    REQUIRE(x == 11);
+    REQUIRE(y == 21);
+
+    // Every element is computed before any is assigned, so the expression
+    // can read the variables it assigns to
+    tuplet::tie(y, x) = tuplet::tie(x, y) + 1;
+    REQUIRE(x == 22);
+    REQUIRE(y == 12);
+}
+
+TEST_CASE("Elementwise eval promotes like scalar arithmetic", "[elementwise]") {
+    using namespace tuplet::elementwise;
+    tuple<int8_t, int16_t> small {100, 1000};
+    tuple<double, float> mixed {0.5, 0.25f};
+
+    auto promoted = eval(small + small);
+    STATIC_REQUIRE(std::is_same_v<decltype(promoted), tuple<int, int>>);
+    REQUIRE(promoted == tuple {200, 2000});
+
+    auto sum = eval(small + mixed);
+    STATIC_REQUIRE(std::is_same_v<decltype(sum), tuple<double, float>>);
+    REQUIRE(sum == tuple {100.5, 1000.25f});
+}
+
+TEST_CASE("Elementwise expressions are constexpr", "[elementwise]") {
+    using namespace tuplet::elementwise;
+    constexpr tuple<int, int, int> a {1, 5, 9};
+    constexpr tuple<int, int, int> clamped = min(max(a, 3), 7);
+    STATIC_REQUIRE(clamped == tuple {3, 5, 7});
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+using tuplet::flatten_t;
+using tuplet::tuple;
+
+namespace {
+    using nested =
+        tuple<tuple<int, char>, double, tuple<float, tuple<short>>, tuple<>>;
+} // namespace
+
+static_assert(std::is_same_v<
+              flatten_t<nested>,
+              tuple<int, char, double, float, short>>);
+static_assert(std::is_same_v<flatten_t<nested const&>, flatten_t<nested>>);
+static_assert(std::is_same_v<flatten_t<tuple<int, long>>, tuple<int, long>>);
+static_assert(std::is_same_v<flatten_t<tuple<>>, tuple<>>);
+static_assert(
+    std::is_same_v<flatten_t<tuple<tuple<>, tuple<tuple<>>>>, tuple<>>);
+// References to tuples are leaves, and reference leaves stay references
+static_assert(std::is_same_v<
+              flatten_t<tuple<tuple<int>&, tuple<int&, tuple<char&&>>>>,
+              tuple<tuple<int>&, int&, char&&>>);
+
+TEST_CASE("flatten() returns the leaves in order", "[flatten]") {
+    nested tup {
+        tuple {1, 'a'},
+        2.5,
+        tuple<float, tuple<short>> {3.5f, tuple<short> {4}},
+        tuple {}};
+    auto flat = tuplet::flatten(tup);
+    static_assert(std::is_same_v<decltype(flat), flatten_t<nested>>);
+    REQUIRE(flat == tuple {1, 'a', 2.5, 3.5f, short(4)});
+
+    // Flattening a flat tuple gives the same tuple
+    REQUIRE(tuplet::flatten(flat) == flat);
+}
+
+TEST_CASE("flatten() moves the leaves out of an rvalue", "[flatten]") {
+    using str = std::string;
+    tuple<tuple<str>, str, tuple<tuple<str>>> tup {
+        tuple<str> {"hello"},
+        "world",
+        tuple<tuple<str>> {tuple<str> {"!"}}};
+    auto flat = tuplet::flatten(std::move(tup));
+    REQUIRE(flat == tuple<str, str, str> {"hello", "world", "!"});
+
+    // Moved from, not copied
+    REQUIRE(tuplet::get<0>(tuplet::get<0>(tup)).empty());
+    REQUIRE(tuplet::get<1>(tup).empty());
+}
+
+TEST_CASE("flatten() keeps reference leaves", "[flatten]") {
+    int a = 1;
+    int b = 2;
+    tuple<tuple<int&>, int&> refs {tuple<int&> {a}, b};
+    auto flat = tuplet::flatten(refs);
+    static_assert(std::is_same_v<decltype(flat), tuple<int&, int&>>);
+    tuplet::get<0>(flat) = 10;
+    tuplet::get<1>(flat) = 20;
+    REQUIRE(a == 10);
+    REQUIRE(b == 20);
+}
+
+TEST_CASE("flatten() is constexpr", "[flatten]") {
+    constexpr tuple<tuple<int, int>, int, tuple<tuple<long>>> tup {
+        tuple {1, 2},
+        3,
+        tuple<tuple<long>> {tuple {4L}}};
+    STATIC_REQUIRE(tuplet::flatten(tup) == tuple {1, 2, 3, 4L});
+}
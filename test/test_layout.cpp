@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string>
+#include <tuplet/layout.hpp>
+#include <tuplet/tuple.hpp>
+
+using tuplet::layout;
+using tuplet::max_padding_v;
+using tuplet::tuple;
+
+using padded_t = tuple<char, int, char, double, short>;
+using packed_t = tuple<int8_t, int8_t, int16_t, int32_t>;
+
+static_assert(layout<padded_t>::offset_of<0> == 0);
+static_assert(layout<padded_t>::offset_of<1> == 4);
+static_assert(layout<padded_t>::offset_of<2> == 8);
+static_assert(layout<padded_t>::offset_of<3> == 16);
+static_assert(layout<padded_t>::offset_of<4> == 24);
+static_assert(layout<padded_t>::size == 32);
+static_assert(layout<padded_t>::align == alignof(double));
+static_assert(layout<padded_t>::padding == 32 - 16);
+static_assert(layout<padded_t>::exact);
+
+// Reordering as double, int, short, char, char removes all padding
+static_assert(layout<padded_t>::optimal_order[0] == 3);
+static_assert(layout<padded_t>::optimal_order[1] == 1);
+static_assert(layout<padded_t>::optimal_order[2] == 4);
+static_assert(layout<padded_t>::optimal_order[3] == 0);
+static_assert(layout<padded_t>::optimal_order[4] == 2);
+static_assert(layout<padded_t>::optimal_size == 16);
+static_assert(layout<padded_t>::optimal_padding == 0);
+
+static_assert(layout<packed_t>::padding == 0);
+static_assert(layout<packed_t>::optimal_padding == 0);
+static_assert(max_padding_v<packed_t, 0>);
+static_assert(!max_padding_v<padded_t, 8>);
+static_assert(max_padding_v<padded_t, 16>);
+
+// References are stored as pointers
+static_assert(layout<tuple<int&, char>>::offset_of<1> == sizeof(int*));
+
+template <class Tup, size_t... I>
+void check_offsets(Tup& tup, std::index_sequence<I...>) {
+    auto base = reinterpret_cast<char const*>(&tup);
+    size_t actual[] {size_t(
+        reinterpret_cast<char const*>(&tuplet::get<I>(tup)) - base)...};
+    for (size_t i = 0; i < Tup::N; i++) {
+        INFO("Element " << i);
+        CHECK(actual[i] == layout<Tup>::offsets[i]);
+    }
+}
+
+template <class Tup>
+void check_offsets() {
+    Tup tup {};
+    REQUIRE(layout<Tup>::exact);
+    check_offsets(tup, std::make_index_sequence<Tup::N>());
+}
+
+TEST_CASE("Computed offsets match the tuple", "[layout]") {
+    check_offsets<padded_t>();
+    check_offsets<packed_t>();
+    check_offsets<tuple<std::string, char, std::string>>();
+    check_offsets<tuple<char, long double, char, int16_t>>();
+    check_offsets<tuple<uint8_t, uint64_t, uint8_t, uint32_t, uint8_t>>();
+}
@@ -0,0 +1,141 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+using tuplet::tag;
+using tuplet::tuple;
+
+namespace {
+    struct counting_func {
+        int* calls;
+
+        template <class T>
+        auto operator()(T const& x) const {
+            ++*calls;
+            return x * 2;
+        }
+    };
+} // namespace
+
+TEST_CASE("lazy_map() applies func when an element is read", "[lazy_map]") {
+    int calls = 0;
+    auto tup = tuple {1, 2.5, 3L};
+    auto view = tup.lazy_map(counting_func {&calls});
+    REQUIRE(calls == 0);
+
+    REQUIRE(tuplet::get<1>(view) == 5.0);
+    REQUIRE(calls == 1);
+    REQUIRE(view[tag<2>()] == 6L);
+    REQUIRE(calls == 2);
+
+    // The view sees changes to the tuple
+    tuplet::get<0>(tup) = 10;
+    REQUIRE(tuplet::get<0>(view) == 20);
+}
+
+TEST_CASE("Chained lazy_maps compose the functions", "[lazy_map]") {
+    auto tup = tuple {1, 2, 3};
+    auto view = tup.lazy_map([](int x) { return x + 1; })
+                    .lazy_map([](int x) { return x * 10; })
+                    .lazy_map([](int x) { return std::to_string(x); });
+    REQUIRE(tuplet::get<2>(view) == "40");
+
+    auto result = view.materialize();
+    static_assert(std::is_same_v<
+                  decltype(result),
+                  tuple<std::string, std::string, std::string>>);
+    REQUIRE(result == tuple<std::string, std::string, std::string> {
+                          "20", "30", "40"});
+}
+
+TEST_CASE("materialize() matches map()", "[lazy_map]") {
+    auto tup = tuple {1, 2.0, 'c'};
+    auto f = [](auto x) { return x + 1; };
+    REQUIRE(tup.lazy_map(f).materialize() == tup.map(f));
+
+    // Functions that return references give tuples of references
+    auto refs =
+        tup.lazy_map([](auto& x) -> auto& { return x; }).materialize();
+    tuplet::get<0>(refs) = 7;
+    REQUIRE(tuplet::get<0>(tup) == 7);
+}
+
+TEST_CASE("lazy_map() on an rvalue owns the tuple", "[lazy_map]") {
+    auto make_view = [] {
+        return tuple {std::string("a"), std::string("b")}.lazy_map(
+            [](std::string s) { return s + "!"; });
+    };
+    auto view = make_view();
+    REQUIRE(tuplet::get<0>(view) == "a!");
+
+    // Materializing an rvalue view moves the elements into func
+    auto result = std::move(view).materialize();
+    REQUIRE(result == tuple<std::string, std::string> {"a!", "b!"});
+    REQUIRE(tuplet::get<1>(view.tuple).empty());
+}
+
+TEST_CASE("Views can be assigned to tuples", "[lazy_map]") {
+    auto tup = tuple {1, 2};
+    tuple<int, long> out;
+    out = tup.lazy_map([](int x) { return x * 10; });
+    REQUIRE(out == tuple {10, 20L});
+}
+
+TEST_CASE("apply() calls func with the elements of a view", "[lazy_map]") {
+    auto tup = tuple {1, 2, 3};
+    auto view = tup.lazy_map([](int x) { return x * 10; });
+    auto sum = [](int a, int b, int c) { return a + b + c; };
+    REQUIRE(tuplet::apply(sum, view) == 60);
+    REQUIRE(tuplet::apply(sum, std::as_const(view)) == 60);
+    REQUIRE(tuplet::apply(sum, std::move(view)) == 60);
+}
+
+TEST_CASE("tuple_cat() accepts views", "[lazy_map]") {
+    auto tup = tuple {1, 2};
+    auto view = tup.lazy_map([](int x) { return std::to_string(x); });
+    auto result = tuplet::tuple_cat(view, tup, std::move(view));
+    static_assert(std::is_same_v<
+                  decltype(result),
+                  tuple<std::string, std::string, int, int, std::string,
+                        std::string>>);
+    REQUIRE(result == tuple<std::string, std::string, int, int, std::string,
+                            std::string> {"1", "2", 1, 2, "1", "2"});
+}
+
+TEST_CASE("lazy_map() accepts mutable functions", "[lazy_map]") {
+    auto tup = tuple {1, 2, 3};
+    auto view = tup.lazy_map([n = 0](int x) mutable { return x + 10 * ++n; });
+    REQUIRE(tuplet::get<0>(view) == 11);
+    REQUIRE(tuplet::get<0>(view) == 21);
+    REQUIRE(view.materialize() == tuple {31, 42, 53});
+
+    auto chained = tup.lazy_map([](int x) { return x; })
+                       .lazy_map([n = 0](int x) mutable { return x * ++n; });
+    // The order apply computes the arguments in is unspecified, but each
+    // element is multiplied by one of 1, 2, and 3
+    REQUIRE(tuplet::apply([](int a, int b, int c) { return a * b * c; },
+                          chained)
+            == (1 * 2 * 3) * (1 * 2 * 3));
+    REQUIRE(tuplet::tuple_cat(chained) == tuple {4, 10, 18});
+}
+
+TEST_CASE("lazy_map() works on empty tuples", "[lazy_map]") {
+    int calls = 0;
+    auto view = tuple {}.lazy_map(counting_func {&calls});
+    REQUIRE(view.materialize() == tuple {});
+    REQUIRE(calls == 0);
+}
+
+TEST_CASE("lazy_map() is constexpr", "[lazy_map]") {
+    constexpr auto tup = tuple {1, 2, 3};
+    constexpr auto sum = [](auto const& view) {
+        return tuplet::get<0>(view) + tuplet::get<1>(view)
+             + tuplet::get<2>(view);
+    };
+    STATIC_REQUIRE(sum(tup.lazy_map([](int x) { return x * x; })) == 14);
+    STATIC_REQUIRE(
+        tup.lazy_map([](int x) { return x + 1; }).materialize()
+        == tuple {2, 3, 4});
+}
@@ -0,0 +1,138 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuplet/thread_pool.hpp>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+using tuplet::get;
+using tuplet::thread_pool;
+using tuplet::tuple;
+
+TEST_CASE("parallel_for_each visits every element", "[parallel]") {
+    thread_pool pool(3);
+    tuple<std::vector<int>, std::vector<long>, std::string> tup {
+        std::vector<int> {1, 2, 3},
+        std::vector<long> {4, 5},
+        "abcd"};
+
+    std::atomic<size_t> visited {0};
+    tup.parallel_for_each(pool, [&](auto& elem) {
+        visited += elem.size();
+        elem.clear();
+    });
+
+    REQUIRE(visited == 9);
+    REQUIRE(tup.all([](auto& elem) { return elem.empty(); }));
+}
+
+TEST_CASE("parallel_for_each runs elements on separate tasks", "[parallel]") {
+    thread_pool pool(2);
+    tuple<int, int, int> tup {0, 1, 2};
+
+    // Each task waits until every task has started, which only finishes if
+    // the tasks run concurrently
+    std::atomic<int> started {0};
+    tup.parallel_for_each(pool, [&](int) {
+        started++;
+        while (started < 3) {
+            std::this_thread::yield();
+        }
+    });
+    REQUIRE(started == 3);
+}
+
+TEST_CASE("parallel_map returns results in declaration order", "[parallel]") {
+    thread_pool pool(2);
+    tuple<std::vector<int>, std::vector<double>, int> tup {
+        std::vector<int> {1, 2, 3},
+        std::vector<double> {0.5, 0.25},
+        7};
+
+    auto sum = [](auto const& elem) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(elem)>, int>) {
+            return elem;
+        } else {
+            return std::accumulate(elem.begin(), elem.end(), elem[0] * 0);
+        }
+    };
+    auto result = tup.parallel_map(pool, sum);
+
+    static_assert(std::is_same_v<decltype(result), tuple<int, double, int>>);
+    REQUIRE(result == tuple {6, 0.75, 7});
+    REQUIRE(result == tup.map(sum));
+}
+
+TEST_CASE("parallel_map forwards elements and results", "[parallel]") {
+    thread_pool pool(2);
+    tuple<std::unique_ptr<int>, std::unique_ptr<int>> tup {
+        std::make_unique<int>(1),
+        std::make_unique<int>(2)};
+
+    SECTION("References are returned as references") {
+        auto refs = tup.parallel_map(pool, [](auto& ptr) -> auto& {
+            return ptr;
+        });
+        REQUIRE(&get<0>(refs) == &get<0>(tup));
+        REQUIRE(&get<1>(refs) == &get<1>(tup));
+    }
+
+    SECTION("Elements of an rvalue tuple can be moved from") {
+        auto moved = std::move(tup).parallel_map(
+            pool,
+            [](std::unique_ptr<int>&& ptr) { return std::move(ptr); });
+        REQUIRE(*get<0>(moved) == 1);
+        REQUIRE(*get<1>(moved) == 2);
+        REQUIRE(get<0>(tup) == nullptr);
+        REQUIRE(get<1>(tup) == nullptr);
+    }
+}
+
+TEST_CASE("parallel_map rethrows exceptions after joining", "[parallel]") {
+    thread_pool pool(2);
+    tuple<int, int, int> tup {1, 2, 3};
+
+    std::atomic<int> finished {0};
+    auto throw_on_2 = [&](int value) {
+        if (value == 2) {
+            throw std::runtime_error("2");
+        }
+        finished++;
+        return std::to_string(value);
+    };
+    REQUIRE_THROWS_AS(tup.parallel_map(pool, throw_on_2), std::runtime_error);
+    REQUIRE(finished == 2);
+}
+
+TEST_CASE("thread_pool supports nested fork_join", "[parallel]") {
+    // With a single worker, the nested call only completes if waiting
+    // threads run queued tasks themselves
+    thread_pool pool(1);
+    tuple<tuple<int, int>, tuple<int, int>> nested {
+        tuple {1, 2},
+        tuple {3, 4}};
+
+    auto sums = nested.parallel_map(pool, [&](auto const& inner) {
+        auto squares = inner.parallel_map(pool, [](int x) { return x * x; });
+        return squares.apply([](int a, int b) { return a + b; });
+    });
+    REQUIRE(sums == tuple {5, 25});
+}
+
+TEST_CASE("thread_pool with no workers runs tasks inline", "[parallel]") {
+    thread_pool pool(0);
+    tuple<int, int> tup {1, 2};
+    auto ids = tup.parallel_map(pool, [](int) {
+        return std::this_thread::get_id();
+    });
+    REQUIRE(get<0>(ids) == std::this_thread::get_id());
+    REQUIRE(get<1>(ids) == std::this_thread::get_id());
+
+    tuple<> empty;
+    empty.parallel_for_each(pool, [](auto&) {});
+    REQUIRE(empty.parallel_map(pool, [](auto&) { return 0; }) == tuple<> {});
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <string>
+#include <tuplet/project.hpp>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using tuplet::tuple;
+
+TEST_CASE("select() copies the listed elements", "[project]") {
+    auto tup = tuple {1, std::string("two"), 3.0, 'f'};
+    auto key = tup.select<3, 0>();
+    static_assert(std::is_same_v<decltype(key), tuple<char, int>>);
+    REQUIRE(key == tuple {'f', 1});
+
+    // Indices can repeat, or be left out
+    REQUIRE(tup.select<0, 0, 2>() == tuple {1, 1, 3.0});
+    REQUIRE(tup.select<>() == tuple {});
+
+    // Moving out of an rvalue
+    auto moved = std::move(tup).select<1>();
+    REQUIRE(tuplet::get<0>(moved) == "two");
+    REQUIRE(tuplet::get<1>(tup).empty());
+}
+
+TEST_CASE("select() keeps reference elements", "[project]") {
+    int a = 1;
+    double b = 2.0;
+    auto refs = tuplet::tie(a, b);
+    auto sel = refs.select<1>();
+    static_assert(std::is_same_v<decltype(sel), tuple<double&>>);
+    tuplet::get<0>(sel) = 5.0;
+    REQUIRE(b == 5.0);
+}
+
+TEST_CASE("tie_select() views the listed elements", "[project]") {
+    auto tup = tuple {1, std::string("two"), 3.0};
+    auto view = tuplet::tie_select<2, 1>(tup);
+    static_assert(std::is_same_v<decltype(view), tuple<double&, std::string&>>);
+    REQUIRE(&tuplet::get<0>(view) == &tuplet::get<2>(tup));
+    tuplet::get<1>(view) = "three";
+    REQUIRE(tuplet::get<1>(tup) == "three");
+
+    auto const& ctup = tup;
+    static_assert(std::is_same_v<
+                  decltype(tuplet::tie_select<0>(ctup)),
+                  tuple<int const&>>);
+}
+
+TEST_CASE("project() compares by the listed elements", "[project]") {
+    using row = tuple<int, std::string, int>;
+    std::vector<row> rows {{3, "c", 1}, {1, "a", 2}, {2, "b", 1}};
+    std::sort(rows.begin(), rows.end(), tuplet::project<2, 0>());
+    REQUIRE(rows == std::vector<row> {{2, "b", 1}, {3, "c", 1}, {1, "a", 2}});
+
+    auto by_name_desc = tuplet::project<1>(std::greater<>());
+    REQUIRE(by_name_desc(rows[1], rows[0]));
+    REQUIRE_FALSE(by_name_desc(rows[0], rows[1]));
+}
+
+TEST_CASE("tuple_hash hashes views like values", "[project]") {
+    auto tup = tuple {1, std::string("two"), 3.0};
+    tuplet::tuple_hash hash;
+    REQUIRE(
+        hash(tuplet::tie_select<0, 1>(tup))
+        == hash(tuple {1, std::string("two")}));
+    REQUIRE(hash(tuple {1, 2}) != hash(tuple {2, 1}));
+}
+
+TEST_CASE("projections hash and compare keys in containers", "[project]") {
+    using row = tuple<int, std::string, double>;
+    using by_key = std::unordered_set<
+        row,
+        tuplet::projection<tuplet::tuple_hash, 0, 1>,
+        tuplet::projection<std::equal_to<>, 0, 1>>;
+    by_key rows;
+    REQUIRE(rows.insert(row {1, "a", 1.0}).second);
+    REQUIRE(rows.insert(row {2, "a", 1.0}).second);
+    // Same key, different payload
+    REQUIRE_FALSE(rows.insert(row {1, "a", 2.0}).second);
+    REQUIRE(rows.size() == 2);
+}
+
+TEST_CASE("select() and project() are constexpr", "[project]") {
+    constexpr auto tup = tuple {1, 2L, 3.0};
+    STATIC_REQUIRE(tup.select<2, 0>() == tuple {3.0, 1});
+    STATIC_REQUIRE(
+        tuplet::project<1>()(tup, tuple {0, 5L, 0.0}));
+}
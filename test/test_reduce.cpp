@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <string>
+#include <tuplet/tuple.hpp>
+
+using tuplet::tuple;
+
+TEST_CASE("tup.reduce() combines elements as a balanced tree", "[reduce]") {
+    auto tup = tuple {1, 2, 3, 4, 5};
+    REQUIRE(tup.reduce(std::plus<>()) == 15);
+    REQUIRE(tuple {7}.reduce(std::plus<>()) == 7);
+
+    // Recording the shape of the tree: five elements split as (2, 3)
+    auto shape = tuple<std::string, std::string, std::string, std::string,
+                       std::string> {"a", "b", "c", "d", "e"}
+                     .reduce([](std::string const& l, std::string const& r) {
+                         return "(" + l + r + ")";
+                     });
+    REQUIRE(shape == "((ab)(c(de)))");
+}
+
+TEST_CASE("tup.reduce() works on mixed types", "[reduce]") {
+    auto tup = tuple {1, 2.5, 3u, 0.5f};
+    REQUIRE(tup.reduce(std::plus<>()) == 7.0);
+}
+
+TEST_CASE("tuplet::reduce() starts from init", "[reduce]") {
+    REQUIRE(tuplet::reduce(tuple {1, 2, 3}, 10, std::plus<>()) == 16);
+    REQUIRE(tuplet::reduce(tuple {}, 10, std::plus<>()) == 10);
+    REQUIRE(
+        tuplet::reduce(tuple {2, 3, 4}, 1, std::multiplies<>()) == 24);
+}
+
+TEST_CASE("tuplet::reduce() is constexpr", "[reduce]") {
+    constexpr auto tup = tuple {3, 1, 4, 1, 5, 9, 2, 6};
+    STATIC_REQUIRE(tup.reduce(std::plus<>()) == 31);
+    STATIC_REQUIRE(tuplet::min(tup) == 1);
+    STATIC_REQUIRE(tuplet::max(tup) == 9);
+    STATIC_REQUIRE(tuplet::argmin(tup) == 1);
+    STATIC_REQUIRE(tuplet::argmax(tup) == 5);
+}
+
+TEST_CASE("min, max, argmin, and argmax", "[reduce]") {
+    auto tup = tuple {2.0, -1.0, 7.5, -1.0, 7.5, 0.0};
+    REQUIRE(tuplet::min(tup) == -1.0);
+    REQUIRE(tuplet::max(tup) == 7.5);
+    // Ties go to the lowest index
+    REQUIRE(tuplet::argmin(tup) == 1);
+    REQUIRE(tuplet::argmax(tup) == 2);
+
+    auto single = tuple {std::string("x")};
+    REQUIRE(tuplet::min(single) == "x");
+    REQUIRE(tuplet::argmax(single) == 0);
+
+    int a = 5, b = 3, c = 8;
+    auto refs = tuplet::tie(a, b, c);
+    REQUIRE(tuplet::min(refs) == 3);
+    REQUIRE(tuplet::argmax(refs) == 2);
+}
@@ -0,0 +1,174 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <thread>
+#include <tuplet/ring.hpp>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+using tuplet::mpmc_ring;
+using tuplet::spsc_ring;
+using tuplet::tuple;
+
+namespace {
+    using msg_t = tuple<uint32_t, uint8_t, double>;
+
+    msg_t make_msg(uint32_t i) { return {i, uint8_t(i * 7), i * 0.5}; }
+
+    /// Pushes and pops single values and batches through a ring, including
+    /// batches that wrap around the end of the buffer
+    template <class Ring>
+    void check_single_thread(Ring& ring) {
+        REQUIRE(ring.capacity() == 8);
+        msg_t out;
+        REQUIRE_FALSE(ring.try_pop(out));
+
+        for (uint32_t i = 0; i < 8; i++) {
+            REQUIRE(ring.try_push(make_msg(i)));
+        }
+        REQUIRE_FALSE(ring.try_push(make_msg(8)));
+
+        for (uint32_t i = 0; i < 5; i++) {
+            REQUIRE(ring.try_pop(out));
+            REQUIRE(out == make_msg(i));
+        }
+
+        // 3 values left, so only 5 of these fit, and they wrap around
+        msg_t batch[6];
+        for (uint32_t i = 0; i < 6; i++) {
+            batch[i] = make_msg(8 + i);
+        }
+        REQUIRE(ring.push_n(batch, 6) == 5);
+
+        msg_t popped[10];
+        REQUIRE(ring.pop_n(popped, 10) == 8);
+        for (uint32_t i = 0; i < 8; i++) {
+            REQUIRE(popped[i] == make_msg(5 + i));
+        }
+        REQUIRE(ring.pop_n(popped, 10) == 0);
+    }
+} // namespace
+
+TEST_CASE("Capacity is rounded up to a power of two", "[ring]") {
+    REQUIRE(spsc_ring<msg_t>(1).capacity() == 2);
+    REQUIRE(spsc_ring<msg_t>(100).capacity() == 128);
+    REQUIRE(mpmc_ring<msg_t>(64).capacity() == 64);
+}
+
+TEST_CASE("spsc_ring pushes and pops in order", "[ring]") {
+    spsc_ring<msg_t> ring(5);
+    check_single_thread(ring);
+}
+
+TEST_CASE("mpmc_ring pushes and pops in order", "[ring]") {
+    mpmc_ring<msg_t> ring(8);
+    check_single_thread(ring);
+}
+
+TEST_CASE("spsc_ring hands values between threads", "[ring]") {
+    spsc_ring<msg_t> ring(64);
+    constexpr uint32_t count = 100000;
+
+    std::thread producer([&] {
+        msg_t batch[16];
+        uint32_t next = 0;
+        while (next < count) {
+            // Alternate single pushes and batches
+            if (next % 3 == 0) {
+                if (!ring.try_push(make_msg(next))) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                next++;
+            } else {
+                size_t n = 0;
+                for (; n < 16 && next + n < count; n++) {
+                    batch[n] = make_msg(uint32_t(next + n));
+                }
+                size_t pushed = ring.push_n(batch, n);
+                next += uint32_t(pushed);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    });
+
+    bool in_order = true;
+    uint32_t expected = 0;
+    msg_t batch[7];
+    while (expected < count) {
+        size_t popped = ring.pop_n(batch, 7);
+        for (size_t i = 0; i < popped; i++) {
+            in_order = in_order && batch[i] == make_msg(expected++);
+        }
+        if (popped == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    REQUIRE(in_order);
+}
+
+TEST_CASE("mpmc_ring delivers every value exactly once", "[ring]") {
+    mpmc_ring<msg_t> ring(32);
+    constexpr int producer_count = 3;
+    constexpr int consumer_count = 3;
+    constexpr uint32_t per_producer = 20000;
+    constexpr uint32_t total = producer_count * per_producer;
+
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<uint32_t> popped {0};
+    std::atomic<bool> corrupted {false};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producer_count; p++) {
+        threads.emplace_back([&, p] {
+            uint32_t first = p * per_producer;
+            uint32_t next = first;
+            msg_t batch[4];
+            while (next < first + per_producer) {
+                size_t n = 0;
+                for (; n < 4 && next + n < first + per_producer; n++) {
+                    batch[n] = make_msg(uint32_t(next + n));
+                }
+                size_t pushed = ring.push_n(batch, n);
+                next += uint32_t(pushed);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumer_count; c++) {
+        threads.emplace_back([&] {
+            msg_t batch[5];
+            while (popped.load() < total) {
+                size_t n = ring.pop_n(batch, 5);
+                for (size_t i = 0; i < n; i++) {
+                    auto id = tuplet::get<0>(batch[i]);
+                    if (id >= total || batch[i] != make_msg(id)) {
+                        corrupted = true;
+                        continue;
+                    }
+                    seen[id]++;
+                }
+                popped += uint32_t(n);
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE_FALSE(corrupted);
+    REQUIRE(popped == total);
+    bool exactly_once = true;
+    for (auto& count : seen) {
+        exactly_once = exactly_once && count == 1;
+    }
+    REQUIRE(exactly_once);
+}
@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuplet/runtime_index.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+using tuplet::tuple;
+
+static_assert(tuplet::detail::_is_array_like<tuple<int, int, int>>);
+static_assert(tuplet::detail::_is_array_like<tuple<std::string>>);
+static_assert(!tuplet::detail::_is_array_like<tuple<int, long>>);
+static_assert(!tuplet::detail::_is_array_like<tuple<int&, int&>>);
+
+template <class Tup, size_t... I>
+void check_contiguous(Tup& tup, std::index_sequence<I...>) {
+    auto* data = tup.data();
+    bool same[] {(&tuplet::get<I>(tup) == data + I)...};
+    for (size_t i = 0; i < sizeof...(I); i++) {
+        INFO("Element " << i);
+        CHECK(same[i]);
+    }
+}
+
+TEST_CASE("Elements of homogeneous tuples are contiguous", "[index]") {
+    tuple<int8_t, int8_t, int8_t, int8_t, int8_t> bytes {};
+    check_contiguous(bytes, std::make_index_sequence<5>());
+
+    tuple<double, double, double> doubles {};
+    check_contiguous(doubles, std::make_index_sequence<3>());
+
+    tuple<std::string, std::string> strings {};
+    check_contiguous(strings, std::make_index_sequence<2>());
+}
+
+TEST_CASE("tup[i] reads and writes elements", "[index]") {
+    auto tup = tuple {10, 20, 30, 40};
+    for (size_t i = 0; i < 4; i++) {
+        REQUIRE(tup[i] == int(i + 1) * 10);
+    }
+    tup[2] = 33;
+    REQUIRE(tuplet::get<2>(tup) == 33);
+
+    auto const& ctup = tup;
+    REQUIRE(ctup[2] == 33);
+
+    // Indexing with a tag still works
+    REQUIRE(tup[tuplet::tag<3>()] == 40);
+}
+
+TEST_CASE("tuplet::at(tup, i) checks the index", "[index]") {
+    auto tup = tuple {1.5, 2.5};
+    REQUIRE(tuplet::at(tup, 1) == 2.5);
+    tuplet::at(tup, 0) = 0.5;
+    REQUIRE(tuplet::get<0>(tup) == 0.5);
+    REQUIRE_THROWS_AS(tuplet::at(tup, 2), std::out_of_range);
+}
+
+#if __cpp_lib_span
+TEST_CASE("tuplet::as_span(tup) views every element", "[index]") {
+    auto tup = tuple {1, 2, 3};
+    auto span = tuplet::as_span(tup);
+    static_assert(decltype(span)::extent == 3);
+    int sum = 0;
+    for (int x : span) {
+        sum += x;
+    }
+    REQUIRE(sum == 6);
+    span[0] = 7;
+    REQUIRE(tuplet::get<0>(tup) == 7);
+
+    auto const& ctup = tup;
+    static_assert(std::is_same_v<
+                  decltype(tuplet::as_span(ctup)),
+                  std::span<int const, 3>>);
+}
+#endif
@@ -0,0 +1,140 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <thread>
+#include <tuplet/seqlock.hpp>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+using tuplet::get;
+using tuplet::seqlock_tuple;
+using tuplet::tuple;
+
+namespace {
+    struct quote {
+        double bid;
+        double ask;
+        uint32_t size;
+    };
+
+    template <class Tuple>
+    struct seqlock_for_t;
+    template <class... T>
+    struct seqlock_for_t<tuple<T...>> {
+        using type = seqlock_tuple<T...>;
+    };
+    template <class Tuple>
+    using seqlock_for = typename seqlock_for_t<Tuple>::type;
+
+    /// Trivially copyable, but not POD, so the next element may be placed
+    /// in its tail padding
+    struct packed_head {
+       private:
+        int a = 0;
+
+       public:
+        char b = 0;
+
+        packed_head() = default;
+        packed_head(int a, char b)
+          : a(a)
+          , b(b) {}
+        int get_a() const { return a; }
+    };
+} // namespace
+
+TEST_CASE("seqlock_tuple reads what was written", "[seqlock]") {
+    seqlock_tuple<uint64_t, quote, char, int16_t> snapshot;
+    REQUIRE(get<0>(snapshot.read()) == 0);
+
+    snapshot.write([](auto& value) {
+        auto& [id, q, flag, count] = value;
+        id = 7;
+        q = quote {1.5, 2.5, 100};
+        flag = 'x';
+        count = -3;
+    });
+
+    auto [id, q, flag, count] = snapshot.read();
+    REQUIRE(id == 7);
+    REQUIRE(q.bid == 1.5);
+    REQUIRE(q.ask == 2.5);
+    REQUIRE(q.size == 100);
+    REQUIRE(flag == 'x');
+    REQUIRE(count == -3);
+
+    snapshot.store({8, quote {3.0, 4.0, 5}, 'y', 9});
+    REQUIRE(snapshot.read<0>() == 8);
+    REQUIRE(snapshot.read<1>().ask == 4.0);
+    REQUIRE(snapshot.read<2>() == 'y');
+    REQUIRE(snapshot.read<3>() == 9);
+}
+
+TEST_CASE("seqlock_tuple reads elements in tail padding", "[seqlock]") {
+    seqlock_tuple<packed_head, char> lock(
+        tuple<packed_head, char> {packed_head(1, 'x'), 'y'});
+    REQUIRE(lock.read<1>() == 'y');
+    REQUIRE(lock.read<0>().get_a() == 1);
+    REQUIRE(lock.read<0>().b == 'x');
+
+    lock.store({packed_head(2, 'z'), 'w'});
+    REQUIRE(lock.read<1>() == 'w');
+    REQUIRE(lock.read<0>().b == 'z');
+}
+
+TEST_CASE("seqlock_tuple write sees the previous value", "[seqlock]") {
+    seqlock_tuple<int, int> counters({1, 2});
+    counters.write([](tuple<int, int>& value) {
+        get<0>(value) += 10;
+        get<1>(value) *= 10;
+    });
+    REQUIRE(counters.read() == tuple<int, int> {11, 20});
+}
+
+TEST_CASE("seqlock_tuple readers never see torn writes", "[seqlock]") {
+    // 256 bytes, written so that every element always holds the same value
+    using wide = tuple<
+        uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+        uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+        uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+        uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+        uint64_t, uint64_t, uint64_t, uint64_t>;
+    static_assert(sizeof(wide) == 256);
+    seqlock_for<wide> snapshot;
+
+    constexpr uint64_t writes = 20000;
+    std::atomic<bool> done {false};
+    std::atomic<bool> torn {false};
+    std::atomic<uint64_t> reads {0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; r++) {
+        readers.emplace_back([&] {
+            uint64_t last = 0;
+            while (!done.load()) {
+                auto value = snapshot.read();
+                uint64_t first = get<0>(value);
+                bool same = value.all([&](uint64_t x) { return x == first; });
+                // Values only grow, so reads never go backwards
+                if (!same || first < last || snapshot.read<31>() < first) {
+                    torn = true;
+                }
+                last = first;
+                reads++;
+            }
+        });
+    }
+
+    for (uint64_t i = 1; i <= writes; i++) {
+        snapshot.write([&](wide& value) {
+            value.for_each([&](uint64_t& x) { x = i; });
+        });
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(!torn);
+    REQUIRE(get<0>(snapshot.read()) == writes);
+}
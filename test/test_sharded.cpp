@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <tuplet/sharded.hpp>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+using tuplet::sharded;
+using tuplet::tuple;
+
+namespace {
+    struct min_fn {
+        template <class T>
+        T operator()(T a, T b) const {
+            return std::min(a, b);
+        }
+    };
+    struct max_fn {
+        template <class T>
+        T operator()(T a, T b) const {
+            return std::max(a, b);
+        }
+    };
+
+    using stats_t = tuple<uint64_t, int64_t, int64_t, int64_t>;
+
+    auto make_stats() {
+        return sharded(
+            stats_t {
+                0,
+                0,
+                std::numeric_limits<int64_t>::max(),
+                std::numeric_limits<int64_t>::min()},
+            tuple {std::plus<>(), std::plus<>(), min_fn(), max_fn()});
+    }
+} // namespace
+
+TEST_CASE("sharded combines values elementwise", "[sharded]") {
+    auto stats = make_stats();
+    {
+        auto shard = stats.claim();
+        shard.add({1, 5, 5, 5});
+        shard.add({1, -3, -3, -3});
+    }
+    {
+        auto shard = stats.claim();
+        shard.add({1, 10, 10, 10});
+    }
+    // The second claim reused the first shard, which kept its values
+    REQUIRE(stats.shard_count() == 1);
+    REQUIRE(stats.collect() == stats_t {3, 12, -3, 10});
+}
+
+TEST_CASE("sharded uses one function for every element", "[sharded]") {
+    sharded<tuple<int, uint8_t, double>, std::plus<>> sums({0, 0, 0.0});
+    auto a = sums.claim();
+    auto b = sums.claim();
+    REQUIRE(sums.shard_count() == 2);
+
+    a.add({1, 2, 0.5});
+    b.add({10, 20, 1.5});
+    a.add({100, 200, 2.0});
+    REQUIRE(sums.collect() == tuple<int, uint8_t, double> {111, 222, 4.0});
+}
+
+TEST_CASE("sharded collects while threads are adding", "[sharded]") {
+    auto stats = make_stats();
+    constexpr int thread_count = 4;
+    constexpr int64_t values = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t] {
+            auto shard = stats.claim();
+            for (int64_t i = 1; i <= values; i++) {
+                int64_t value = t * values + i;
+                shard.add({1, value, value, value});
+            }
+        });
+    }
+
+    // Partial results are consistent: the count never exceeds the number
+    // of values added, and min <= max once anything was added
+    for (int i = 0; i < 100; i++) {
+        auto [count, sum, min, max] = stats.collect();
+        REQUIRE(count <= uint64_t(thread_count * values));
+        if (count > 0) {
+            REQUIRE(min <= max);
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    int64_t n = thread_count * values;
+    REQUIRE(stats.collect() == stats_t {uint64_t(n), n * (n + 1) / 2, 1, n});
+}
@@ -0,0 +1,153 @@
+#if __has_include(<sys/mman.h>)
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuplet/shm_channel.hpp>
+#include <tuplet/tuple.hpp>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using tuplet::shm_channel;
+using tuplet::tuple;
+
+namespace {
+    using row_t = tuple<uint64_t, uint32_t, uint16_t, double>;
+
+    row_t make_row(uint64_t i) {
+        return {i, uint32_t(i * 3), uint16_t(i), i * 0.5};
+    }
+
+    /// A segment name unique to this process and test, removed afterwards
+    struct segment_name {
+        std::string value;
+
+        explicit segment_name(char const* test)
+          : value(
+              "/tuplet-" + std::string(test) + "-"
+              + std::to_string(getpid())) {
+            shm_channel<row_t>::remove(value);
+        }
+        ~segment_name() { shm_channel<row_t>::remove(value); }
+    };
+} // namespace
+
+TEST_CASE("shm_channel passes rows through a segment", "[shm_channel]") {
+    segment_name name("rows");
+    auto tx = shm_channel<row_t>::create(name.value, 6);
+    auto rx = shm_channel<row_t>::attach(name.value);
+    REQUIRE(tx.capacity() == 8);
+    REQUIRE(rx.capacity() == 8);
+
+    row_t out;
+    REQUIRE_FALSE(rx.try_receive(out));
+    REQUIRE(rx.readable().empty());
+
+    for (uint64_t i = 0; i < 8; i++) {
+        REQUIRE(tx.try_send(make_row(i)));
+    }
+    REQUIRE_FALSE(tx.try_send(make_row(8)));
+
+    REQUIRE(rx.receive() == make_row(0));
+    REQUIRE(rx.try_receive(out));
+    REQUIRE(out == make_row(1));
+
+    // Six rows remain, and two slots are free; sending four wraps around
+    row_t batch[4] = {make_row(8), make_row(9), make_row(10), make_row(11)};
+    REQUIRE(tx.send_n(batch, 4) == 2);
+
+    // Rows are read in place, up to the end of the ring
+    auto rows = rx.readable();
+    REQUIRE(rows.size() == 6);
+    for (size_t i = 0; i < rows.size(); i++) {
+        REQUIRE(rows[i] == make_row(2 + i));
+    }
+    rx.consume(rows.size());
+
+    rows = rx.wait_readable();
+    REQUIRE(rows.size() == 2);
+    REQUIRE(rows[0] == make_row(8));
+    REQUIRE(rows[1] == make_row(9));
+    rx.consume(2);
+    REQUIRE(rx.readable().empty());
+}
+
+TEST_CASE("shm_channel rejects mismatched segments", "[shm_channel]") {
+    segment_name name("mismatch");
+    auto tx = shm_channel<row_t>::create(name.value, 16);
+
+    // Same size and alignment, but different element types
+    using other_t = tuple<uint64_t, float, uint16_t, double>;
+    STATIC_REQUIRE(sizeof(other_t) == sizeof(row_t));
+    STATIC_REQUIRE(shm_channel<other_t>::fingerprint
+                   != shm_channel<row_t>::fingerprint);
+    REQUIRE_THROWS_AS(
+        shm_channel<other_t>::attach(name.value),
+        std::runtime_error);
+
+    REQUIRE_THROWS_AS(
+        shm_channel<row_t>::create(name.value, 16),
+        std::system_error);
+    REQUIRE_THROWS_AS(
+        shm_channel<row_t>::attach("/tuplet-does-not-exist"),
+        std::system_error);
+}
+
+TEST_CASE("shm_channel hands rows to another process", "[shm_channel]") {
+    segment_name name("fork");
+    constexpr uint64_t count = 1000000;
+    auto rx = shm_channel<row_t>::create(name.value, 1024);
+
+    pid_t child = fork();
+    if (child == 0) {
+        // The producer process: alternate single rows and batches
+        int status = 0;
+        try {
+            auto tx = shm_channel<row_t>::attach(name.value);
+            row_t batch[32];
+            uint64_t next = 0;
+            while (next < count) {
+                if (next % 2 == 0) {
+                    tx.send(make_row(next++));
+                    continue;
+                }
+                size_t n = 0;
+                for (; n < 32 && next + n < count; n++) {
+                    batch[n] = make_row(next + n);
+                }
+                next += tx.send_n(batch, n);
+            }
+        } catch (...) {
+            status = 1;
+        }
+        _exit(status);
+    }
+    REQUIRE(child > 0);
+
+    auto start = std::chrono::steady_clock::now();
+    bool in_order = true;
+    uint64_t expected = 0;
+    while (expected < count) {
+        auto rows = rx.wait_readable();
+        for (row_t const& row : rows) {
+            in_order = in_order && row == make_row(expected++);
+        }
+        rx.consume(rows.size());
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now()
+                                          - start;
+
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(in_order);
+    WARN(
+        "shm_channel: " << count / elapsed.count() / 1e6
+                        << " million rows/s between two processes");
+}
+#endif
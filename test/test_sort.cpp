@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <tuplet/sort.hpp>
+#include <utility>
+
+using tuplet::tuple;
+
+namespace {
+    template <size_t... I>
+    auto to_tuple(
+        std::array<int, sizeof...(I)> const& arr,
+        std::index_sequence<I...>) {
+        return tuple {arr[I]...};
+    }
+
+    template <class T, class Tup, size_t... I>
+    auto to_array_of(Tup const& tup, std::index_sequence<I...>) {
+        return std::array<T, sizeof...(I)> {tup[tuplet::tag<I>()]...};
+    }
+
+    template <class Tup, size_t... I>
+    auto to_array(Tup const& tup, std::index_sequence<I...> indices) {
+        return to_array_of<int>(tup, indices);
+    }
+
+    /// A network sorts every input iff it sorts every input of 0s and 1s,
+    /// so checking all 2^N of those checks the network
+    template <size_t N>
+    bool sorts_all_bit_patterns() {
+        auto indices = std::make_index_sequence<N>();
+        for (size_t bits = 0; bits < (size_t(1) << N); bits++) {
+            std::array<int, N> arr {};
+            for (size_t i = 0; i < N; i++) {
+                arr[i] = (bits >> i) & 1;
+            }
+            auto tup = to_tuple(arr, indices);
+            tuplet::sort_elements(tup);
+            auto out = to_array(tup, indices);
+            if (!std::is_sorted(out.begin(), out.end())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <size_t... N>
+    bool sorts_all_sizes(std::index_sequence<N...>) {
+        return (sorts_all_bit_patterns<N>() && ...);
+    }
+} // namespace
+
+TEST_CASE("Networks sort every input of 1 to 18 elements", "[sort]") {
+    // 1 through 16 use fixed networks, and 17 and 18 use Batcher's network
+    REQUIRE(sorts_all_sizes(std::index_sequence<1, 2, 3, 4, 5, 6, 7, 8>()));
+    REQUIRE(sorts_all_sizes(std::index_sequence<9, 10, 11, 12, 13, 14>()));
+    REQUIRE(sorts_all_sizes(std::index_sequence<15, 16, 17, 18>()));
+}
+
+TEST_CASE("sort_elements() matches std::sort", "[sort]") {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(-100.0, 100.0);
+    for (int trial = 0; trial < 1000; trial++) {
+        std::array<double, 9> arr;
+        for (auto& x : arr) {
+            x = dist(rng);
+        }
+        auto tup = tuple {arr[0], arr[1], arr[2], arr[3], arr[4], arr[5],
+                          arr[6], arr[7], arr[8]};
+        tuplet::sort_elements(tup);
+        std::sort(arr.begin(), arr.end());
+        REQUIRE(tup == tuple {arr[0], arr[1], arr[2], arr[3], arr[4],
+                              arr[5], arr[6], arr[7], arr[8]});
+    }
+}
+
+TEST_CASE("sorted() returns a sorted copy", "[sort]") {
+    auto tup = tuple {5, 3, 9, 1, 3};
+    REQUIRE(tuplet::sorted(tup) == tuple {1, 3, 3, 5, 9});
+    REQUIRE(tup == tuple {5, 3, 9, 1, 3});
+
+    REQUIRE(
+        tuplet::sorted(tup, std::greater<>()) == tuple {9, 5, 3, 3, 1});
+    REQUIRE(tuplet::sorted(tuple {4.5f}) == tuple {4.5f});
+}
+
+TEST_CASE("sort_elements() takes any comparison", "[sort]") {
+    auto by_abs = [](int a, int b) { return std::abs(a) < std::abs(b); };
+    auto tup = tuple {-4, 1, -2, 3};
+    tuplet::sort_elements(tup, by_abs);
+    REQUIRE(tup == tuple {1, -2, 3, -4});
+
+    auto words = tuple<std::string, std::string, std::string, std::string> {
+        "pear", "fig", "apple", "kiwi"};
+    tuplet::sort_elements(words);
+    REQUIRE(words == tuple<std::string, std::string, std::string,
+                           std::string> {"apple", "fig", "kiwi", "pear"});
+}
+
+TEST_CASE("Sorting floats never duplicates or drops values", "[sort]") {
+    // NaN isn't ordered, and -0.0 == 0.0, so the output may be in any
+    // order, but it must hold the same bit patterns as the input
+    auto bits = [](std::array<float, 5> const& arr) {
+        std::array<uint32_t, 5> result;
+        for (size_t i = 0; i < 5; i++) {
+            std::memcpy(&result[i], &arr[i], sizeof(float));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+    std::array<float, 5> arr {NAN, 1.0f, -0.0f, 0.0f, -1.0f};
+    std::sort(arr.begin(), arr.end(), [](float a, float b) {
+        return std::memcmp(&a, &b, sizeof(float)) < 0;
+    });
+    do {
+        auto tup = tuple {arr[0], arr[1], arr[2], arr[3], arr[4]};
+        auto down = tup;
+        tuplet::sort_elements(tup);
+        tuplet::sort_elements(down, std::greater<>());
+        auto out = to_array_of<float>(tup, std::make_index_sequence<5>());
+        auto out_down =
+            to_array_of<float>(down, std::make_index_sequence<5>());
+        REQUIRE(bits(out) == bits(arr));
+        REQUIRE(bits(out_down) == bits(arr));
+    } while (std::next_permutation(
+        arr.begin(),
+        arr.end(),
+        [](float a, float b) {
+            return std::memcmp(&a, &b, sizeof(float)) < 0;
+        }));
+
+    REQUIRE(tuplet::sorted(tuple {1.0, double(NAN)}) != tuple {1.0, 1.0});
+    auto pair = tuplet::sorted(tuple {double(NAN), 1.0});
+    REQUIRE(
+        (std::isnan(tuplet::get<0>(pair)) != std::isnan(tuplet::get<1>(pair))));
+}
+
+TEST_CASE("Sorting a tuple of references sorts the values", "[sort]") {
+    int a = 3, b = 1, c = 2;
+    auto refs = tuplet::tie(a, b, c);
+    tuplet::sort_elements(refs);
+    REQUIRE(a == 1);
+    REQUIRE(b == 2);
+    REQUIRE(c == 3);
+}
+
+TEST_CASE("Sorting is constexpr", "[sort]") {
+    constexpr auto tup = tuplet::sorted(tuple {3, 1, 4, 1, 5, 9, 2, 6});
+    STATIC_REQUIRE(tup == tuple {1, 1, 2, 3, 4, 5, 6, 9});
+
+    constexpr auto floats = tuplet::sorted(tuple {2.5f, -1.f, 0.5f});
+    STATIC_REQUIRE(floats == tuple {-1.f, 0.5f, 2.5f});
+    constexpr auto down =
+        tuplet::sorted(tuple {2.5, -1.0, 0.5}, std::greater<>());
+    STATIC_REQUIRE(down == tuple {2.5, 0.5, -1.0});
+}
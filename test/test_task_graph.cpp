@@ -0,0 +1,127 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuplet/task_graph.hpp>
+#include <tuplet/tuple.hpp>
+#include <tuplet/work_stealing_pool.hpp>
+#include <vector>
+
+using tuplet::get;
+using tuplet::inputs;
+using tuplet::node;
+using tuplet::task_graph;
+using tuplet::tuple;
+using tuplet::work_stealing_pool;
+
+TEST_CASE("task_graph passes outputs to later nodes", "[task_graph]") {
+    work_stealing_pool pool(2);
+    task_graph graph {
+        node([] { return 6; }),
+        node([] { return std::string("x"); }),
+        node([](int n, std::string const& s) { return tuple {n, s + s}; },
+             inputs<0, 1>),
+        node([](tuple<int, std::string> const& t) {
+            return std::string(get<0>(t), get<1>(t)[0]);
+        },
+             inputs<2>)};
+
+    using graph_t = decltype(graph);
+    static_assert(std::is_same_v<graph_t::output_t<2>, tuple<int, std::string>>);
+    static_assert(std::is_same_v<
+                  graph_t::input_t<2>,
+                  tuple<int const&, std::string const&>>);
+
+    auto [six, x, pair, xs] = graph.run(pool);
+    REQUIRE(six == 6);
+    REQUIRE(x == "x");
+    REQUIRE(pair == tuple<int, std::string> {6, "xx"});
+    REQUIRE(xs == "xxxxxx");
+
+    // A graph can be run more than once
+    REQUIRE(graph.run(pool) == graph_t::result_type {6, "x", {6, "xx"}, "xxxxxx"});
+}
+
+TEST_CASE("task_graph runs independent nodes in parallel", "[task_graph]") {
+    work_stealing_pool pool(2);
+
+    // Three nodes that each wait for the other two to start, which only
+    // finishes if they run at the same time
+    std::atomic<int> started {0};
+    auto rendezvous = [&] {
+        started++;
+        while (started < 3) {
+            std::this_thread::yield();
+        }
+        return 1;
+    };
+    task_graph graph {
+        node(rendezvous),
+        node(rendezvous),
+        node(rendezvous),
+        node([](int a, int b, int c) { return a + b + c; }, inputs<0, 1, 2>)};
+    REQUIRE(get<3>(graph.run(pool)) == 3);
+}
+
+TEST_CASE("task_graph orders nodes by their inputs", "[task_graph]") {
+    work_stealing_pool pool(3);
+    std::vector<int> order;
+    std::mutex mutex;
+    auto visit = [&](int id) {
+        return [&, id](auto const&...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+        };
+    };
+    // Diamond: 0 -> {1, 2} -> 3, with void outputs
+    task_graph graph {
+        node(visit(0)),
+        node(visit(1), inputs<0>),
+        node(visit(2), inputs<0>),
+        node(visit(3), inputs<1, 2>)};
+    static_assert(std::is_same_v<decltype(graph)::output_t<3>, tuple<>>);
+
+    for (int i = 0; i < 100; i++) {
+        order.clear();
+        graph.run(pool);
+        REQUIRE(order.size() == 4);
+        REQUIRE(order.front() == 0);
+        REQUIRE(order.back() == 3);
+    }
+}
+
+TEST_CASE("task_graph rethrows and skips dependents", "[task_graph]") {
+    work_stealing_pool pool(1);
+    bool ran_dependent = false;
+    task_graph graph {
+        node([]() -> int { throw std::runtime_error("failed"); }),
+        node([&](int) { ran_dependent = true; }, inputs<0>)};
+    REQUIRE_THROWS_AS(graph.run(pool), std::runtime_error);
+    REQUIRE_FALSE(ran_dependent);
+}
+
+TEST_CASE("task_graph returns move-only outputs", "[task_graph]") {
+    work_stealing_pool pool(0);
+    task_graph graph {
+        node([] { return std::make_unique<int>(4); }),
+        node([](std::unique_ptr<int> const& p) { return *p * 2; }, inputs<0>)};
+    auto [ptr, doubled] = graph.run(pool);
+    REQUIRE(*ptr == 4);
+    REQUIRE(doubled == 8);
+}
+
+TEST_CASE("work_stealing_pool supports nested fork_join", "[task_graph]") {
+    work_stealing_pool pool(2);
+    std::atomic<int> count {0};
+    auto leaf = [&] { count++; };
+    auto branch = [&] { pool.fork_join(leaf, leaf, leaf); };
+    pool.fork_join(branch, branch, branch, branch);
+    REQUIRE(count == 12);
+
+    // work_stealing_pool can also be used with parallel_map
+    tuple<int, int> tup {1, 2};
+    REQUIRE(tup.parallel_map(pool, [](int x) { return x * 10; }) == tuple {10, 20});
+}
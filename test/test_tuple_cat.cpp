@@ -51,3 +51,24 @@ TEST_CASE("test tuple_cat", "[tuple_cat]") {
     REQUIRE(tup[3_tag] == 'b');
     REQUIRE(tup[4_tag] == 'c');
 }
+
+TEST_CASE("tuple_cat strategy can be chosen per call", "[tuple_cat]") {
+    using tuplet::cat_strategy;
+    tuple<int, std::string> a {1, "Hello"};
+    tuple<double> b {2.5};
+
+    auto by_value = tuplet::tuple_cat<cat_strategy::by_value>(a, b);
+    auto by_forwarding = tuplet::tuple_cat<cat_strategy::by_forwarding_tuple>(
+        a,
+        b);
+    auto automatic = tuplet::tuple_cat(a, b);
+
+    static_assert(
+        std::is_same_v<decltype(by_value), tuple<int, std::string, double>>);
+    static_assert(std::is_same_v<decltype(by_value), decltype(by_forwarding)>);
+    static_assert(std::is_same_v<decltype(by_value), decltype(automatic)>);
+
+    REQUIRE(by_value == tuple {1, std::string("Hello"), 2.5});
+    REQUIRE(by_forwarding == by_value);
+    REQUIRE(automatic == by_value);
+}
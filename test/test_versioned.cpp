@@ -0,0 +1,136 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <tuplet/tuple.hpp>
+#include <tuplet/versioned.hpp>
+#include <vector>
+
+using tuplet::get;
+using tuplet::tuple;
+using tuplet::versioned;
+
+namespace {
+    using row = tuple<uint32_t, uint32_t, double>;
+
+    /// Counts live instances, to check when versions are deleted
+    struct tracked {
+        static inline int live = 0;
+        int value = 0;
+
+        tracked(int value = 0)
+          : value(value) {
+            live++;
+        }
+        tracked(tracked const& other)
+          : value(other.value) {
+            live++;
+        }
+        ~tracked() { live--; }
+    };
+} // namespace
+
+TEST_CASE("versioned readers see the latest published version", "[versioned]") {
+    versioned<std::vector<row>> table(std::vector<row> {row {1, 2, 0.5}});
+    auto reader = table.reader();
+
+    {
+        auto pinned = reader.pin();
+        REQUIRE(pinned->size() == 1);
+        REQUIRE(get<1>((*pinned)[0]) == 2);
+    }
+
+    table.publish(std::vector<row> {row {3, 4, 1.5}, row {5, 6, 2.5}});
+    REQUIRE(reader.pin()->size() == 2);
+
+    table.update([](std::vector<row>& rows) { rows.push_back({7, 8, 3.5}); });
+    auto pinned = reader.pin();
+    REQUIRE(pinned->size() == 3);
+    REQUIRE(get<0>(pinned->back()) == 7);
+}
+
+TEST_CASE("versioned keeps pinned versions alive", "[versioned]") {
+    {
+        versioned<tracked> value(tracked {1});
+        auto reader = value.reader();
+        auto other_reader = value.reader();
+        REQUIRE(tracked::live == 1);
+
+        {
+            auto pinned = reader.pin();
+            value.publish(tracked {2});
+            value.publish(tracked {3});
+
+            // The first version is still pinned, and the second was
+            // published after the pin, so neither can be deleted yet
+            REQUIRE(pinned->value == 1);
+            REQUIRE(value.retired_count() == 2);
+            REQUIRE(other_reader.pin()->value == 3);
+        }
+
+        value.reclaim();
+        REQUIRE(value.retired_count() == 0);
+        REQUIRE(tracked::live == 1);
+    }
+    REQUIRE(tracked::live == 0);
+}
+
+TEST_CASE("versioned reuses the slots of finished readers", "[versioned]") {
+    versioned<int> value(1);
+    for (int i = 0; i < 100; i++) {
+        auto reader = value.reader();
+        REQUIRE(*reader.pin() == i + 1);
+        value.publish(i + 2);
+    }
+    REQUIRE(value.retired_count() == 0);
+}
+
+TEST_CASE("versioned readers never see a deleted version", "[versioned]") {
+    // Every element of a version holds its version number, and a deleted
+    // vector would fail the check (or trip a sanitizer)
+    versioned<std::vector<uint64_t>> value(std::vector<uint64_t>(64, 0));
+    std::atomic<bool> done {false};
+    std::atomic<bool> inconsistent {false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; r++) {
+        readers.emplace_back([&] {
+            auto reader = value.reader();
+            uint64_t last = 0;
+            while (!done.load()) {
+                auto pinned = reader.pin();
+                uint64_t version = pinned->front();
+                for (uint64_t elem : *pinned) {
+                    if (elem != version) {
+                        inconsistent = true;
+                    }
+                }
+                if (version < last) {
+                    inconsistent = true;
+                }
+                last = version;
+            }
+        });
+    }
+
+    for (uint64_t version = 1; version <= 2000; version++) {
+        if (version % 2 == 0) {
+            value.publish(std::vector<uint64_t>(64, version));
+        } else {
+            value.update([&](std::vector<uint64_t>& elems) {
+                for (auto& elem : elems) {
+                    elem = version;
+                }
+            });
+        }
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(!inconsistent);
+    value.reclaim();
+    REQUIRE(value.retired_count() == 0);
+}
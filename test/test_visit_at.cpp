@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <tuplet/runtime_index.hpp>
+#include <tuplet/tuple.hpp>
+#include <type_traits>
+#include <utility>
+
+using tuplet::tuple;
+
+namespace {
+    enum category { lvalue, const_lvalue, rvalue };
+
+    struct which_category {
+        template <class T>
+        category operator()(T&) const {
+            return std::is_const_v<T> ? const_lvalue : lvalue;
+        }
+        template <class T>
+        category operator()(T&&) const {
+            return rvalue;
+        }
+    };
+
+    struct to_string {
+        std::string operator()(int x) const { return std::to_string(x); }
+        std::string operator()(double x) const {
+            return std::to_string(int(x * 10));
+        }
+        std::string operator()(std::string const& x) const { return x; }
+    };
+} // namespace
+
+TEST_CASE("visit_at() calls func on element i", "[visit_at]") {
+    auto tup = tuple {1, 2.5, std::string("three")};
+    REQUIRE(tuplet::visit_at(tup, 0, to_string()) == "1");
+    REQUIRE(tuplet::visit_at(tup, 1, to_string()) == "25");
+    REQUIRE(tuplet::visit_at(tup, 2, to_string()) == "three");
+
+    tuplet::visit_at(tup, 2, [](auto& x) { x += x; });
+    REQUIRE(tuplet::get<2>(tup) == "threethree");
+}
+
+TEST_CASE("visit_at() keeps the value category", "[visit_at]") {
+    auto tup = tuple {1, std::string("x")};
+    auto const& ctup = tup;
+    REQUIRE(tuplet::visit_at(tup, 1, which_category()) == lvalue);
+    REQUIRE(tuplet::visit_at(ctup, 1, which_category()) == const_lvalue);
+    REQUIRE(
+        tuplet::visit_at(std::move(tup), 1, which_category()) == rvalue);
+
+    // Elements that are references stay references
+    int a = 0;
+    auto refs = tuple<int&, int&> {a, a};
+    tuplet::visit_at(refs, 1, [](int& x) { x = 5; });
+    REQUIRE(a == 5);
+}
+
+TEST_CASE("visit_at() can return references", "[visit_at]") {
+    auto tup = tuple {1, 2, 3};
+    int& elem = tuplet::visit_at(tup, 1, [](int& x) -> int& { return x; });
+    REQUIRE(&elem == &tuplet::get<1>(tup));
+}
+
+TEST_CASE("visit_at() throws if i is out of range", "[visit_at]") {
+    auto tup = tuple {1, 2.0};
+    REQUIRE_THROWS_AS(
+        tuplet::visit_at(tup, 2, [](auto const&) {}),
+        std::out_of_range);
+}
+
+TEST_CASE("visit_at() is constexpr", "[visit_at]") {
+    constexpr auto tup = tuple {3, 4L, 5.0};
+    STATIC_REQUIRE(
+        tuplet::visit_at(tup, 1, [](auto x) { return long(x); }) == 4);
+}
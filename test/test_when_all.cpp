@@ -0,0 +1,135 @@
+#include <tuplet/when_all.hpp>
+
+#if __cpp_impl_coroutine
+#include "util/event_loop.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuplet/tuple.hpp>
+#include <vector>
+
+using loop::event_loop;
+using loop::task;
+using tuplet::tuple;
+
+namespace {
+    task<std::string> greet(
+        event_loop& loop,
+        int turns,
+        std::vector<int>& finished) {
+        co_await loop.sleep(turns);
+        finished.push_back(turns);
+        co_return "slept " + std::to_string(turns);
+    }
+
+    task<std::unique_ptr<int>> make_ptr(event_loop& loop, int value) {
+        co_await loop.yield();
+        co_return std::make_unique<int>(value);
+    }
+
+    task<int> fail(event_loop& loop) {
+        co_await loop.yield();
+        throw std::runtime_error("failed");
+    }
+
+    /// Awaitable that completes without suspending
+    struct ready_value {
+        int value;
+        bool await_ready() const noexcept { return true; }
+        void await_suspend(std::coroutine_handle<>) const noexcept {}
+        int await_resume() const noexcept { return value; }
+    };
+
+    /// Awaitable that completes with a reference
+    struct ready_ref {
+        int& ref;
+        bool await_ready() const noexcept { return true; }
+        void await_suspend(std::coroutine_handle<>) const noexcept {}
+        int& await_resume() const noexcept { return ref; }
+    };
+
+    /// Awaitable that returns an int after two turns, via operator co_await
+    struct yield_twice {
+        event_loop& loop;
+        task<int> operator co_await() const { return loop.sleep(2); }
+    };
+} // namespace
+
+TEST_CASE("when_all runs awaitables concurrently", "[when_all]") {
+    using result_t = tuple<std::string, std::string, std::string>;
+    event_loop loop;
+    std::vector<int> finished;
+    auto result = loop.run([&]() -> task<result_t> {
+        co_return co_await tuplet::when_all(
+            greet(loop, 3, finished),
+            greet(loop, 5, finished),
+            greet(loop, 4, finished));
+    }());
+
+    REQUIRE(result == result_t {"slept 3", "slept 5", "slept 4"});
+    // Awaited one after the other, they would finish in argument order
+    REQUIRE(finished == std::vector {3, 4, 5});
+}
+
+TEST_CASE("when_all result types", "[when_all]") {
+    using result_t = tuple<std::unique_ptr<int>, int, tuple<>, int&>;
+    event_loop loop;
+    int value = 10;
+
+    auto [ptr, ready, unit, ref] = loop.run([&]() -> task<result_t> {
+        auto all = tuplet::when_all(
+            make_ptr(loop, 1),
+            ready_value {2},
+            loop.yield(),
+            ready_ref {value});
+        static_assert(std::is_same_v<decltype(all.await_resume()), result_t>);
+        co_return co_await all;
+    }());
+
+    REQUIRE(*ptr == 1);
+    REQUIRE(ready == 2);
+    REQUIRE(&ref == &value);
+}
+
+TEST_CASE("when_all supports operator co_await and lvalues", "[when_all]") {
+    event_loop loop;
+    auto result = loop.run([&]() -> task<int> {
+        yield_twice twice {loop};
+        auto [turns, value] = co_await tuplet::when_all(twice, ready_value {7});
+        co_return turns + value;
+    }());
+    REQUIRE(result == 9);
+}
+
+TEST_CASE("when_all completes without suspending", "[when_all]") {
+    event_loop loop;
+    auto result = loop.run([&]() -> task<int> {
+        auto [a, b] = co_await tuplet::when_all(
+            ready_value {1},
+            ready_value {2});
+        auto empty = co_await tuplet::when_all();
+        static_assert(std::is_same_v<decltype(empty), tuple<>>);
+        co_return a + b;
+    }());
+    REQUIRE(result == 3);
+    REQUIRE(loop.turns == 0);
+}
+
+TEST_CASE("when_all rethrows after every awaitable finishes", "[when_all]") {
+    event_loop loop;
+    bool finished_slow = false;
+    auto slow = [&]() -> task<int> {
+        co_await loop.sleep(5);
+        finished_slow = true;
+        co_return 0;
+    };
+    REQUIRE_THROWS_AS(
+        loop.run([&]() -> task<int> {
+            co_await tuplet::when_all(fail(loop), slow());
+            co_return 0;
+        }()),
+        std::runtime_error);
+    REQUIRE(finished_slow);
+}
+#endif
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <tuplet/zip.hpp>
+#include <type_traits>
+#include <vector>
+
+using tuplet::get;
+using tuplet::tuple;
+
+TEST_CASE("zip yields tuples of references", "[zip]") {
+    std::vector<int> a {1, 2, 3};
+    std::array<double, 3> b {0.5, 1.5, 2.5};
+    using view = decltype(tuplet::zip(a, b));
+    using reference = std::iterator_traits<view::iterator>::reference;
+    using value_type = std::iterator_traits<view::iterator>::value_type;
+
+    STATIC_REQUIRE(view::contiguous);
+    STATIC_REQUIRE(std::is_same_v<reference, tuple<int&, double&>>);
+    STATIC_REQUIRE(std::is_same_v<value_type, tuple<int, double>>);
+
+    for (auto [x, y] : tuplet::zip(a, b)) {
+        x *= 10;
+        y += x;
+    }
+    REQUIRE(a == std::vector<int> {10, 20, 30});
+    REQUIRE(b == std::array<double, 3> {10.5, 21.5, 32.5});
+}
+
+TEST_CASE("zip stops at the end of the shortest range", "[zip]") {
+    std::vector<int> a {1, 2, 3, 4};
+    int b[] {10, 20};
+    std::string c = "xyz";
+
+    auto view = tuplet::zip(a, b, c);
+    REQUIRE(view.size() == 2);
+    REQUIRE(std::distance(view.begin(), view.end()) == 2);
+
+    std::vector<tuple<int, int, char>> seen;
+    for (auto elems : view) {
+        tuple<int, int, char> copy = tuplet::convert {elems};
+        seen.push_back(copy);
+    }
+    REQUIRE(
+        seen
+        == std::vector<tuple<int, int, char>> {
+            tuple<int, int, char> {1, 10, 'x'},
+            tuple<int, int, char> {2, 20, 'y'}});
+}
+
+TEST_CASE("zip over contiguous ranges can be indexed", "[zip]") {
+    std::vector<int> a {1, 2, 3, 4};
+    std::vector<int> const b {5, 6, 7, 8};
+    auto view = tuplet::zip(a, b);
+    auto it = view.begin();
+
+    // Dereferencing gives a proxy, so the iterator is only tagged as an
+    // input iterator, even though it supports indexing and arithmetic
+    STATIC_REQUIRE(std::is_same_v<
+                   std::iterator_traits<decltype(it)>::iterator_category,
+                   std::input_iterator_tag>);
+    STATIC_REQUIRE(std::is_same_v<decltype(*it), tuple<int&, int const&>>);
+
+    REQUIRE(get<1>(it[2]) == 7);
+    REQUIRE(get<0>(*(it + 3)) == 4);
+    REQUIRE(view.end() - it == 4);
+    REQUIRE(it < view.end());
+    it += 4;
+    REQUIRE(it == view.end());
+}
+
+TEST_CASE("Standard algorithms work on zip views", "[zip]") {
+    std::vector<int> a {1, 2, 3, 4};
+    std::vector<double> b {0.5, 1.5, 2.5, 3.5};
+    auto view = tuplet::zip(a, b);
+
+    double dot = std::accumulate(
+        view.begin(),
+        view.end(),
+        0.0,
+        [](double sum, tuple<int&, double&> elems) {
+            return sum + get<0>(elems) * get<1>(elems);
+        });
+    REQUIRE(dot == 0.5 + 3.0 + 7.5 + 14.0);
+
+    auto it = std::find_if(view.begin(), view.end(), [](auto elems) {
+        return get<1>(elems) > 2.0;
+    });
+    REQUIRE(it - view.begin() == 2);
+    REQUIRE(std::distance(view.begin(), view.end()) == 4);
+
+    auto odd = std::count_if(view.begin(), view.end(), [](auto elems) {
+        return get<0>(elems) % 2 == 1;
+    });
+    REQUIRE(odd == 2);
+}
+
+TEST_CASE("zip works with ranges that aren't contiguous", "[zip]") {
+    std::list<int> a {1, 2, 3};
+    std::vector<std::string> b {"a", "b", "c", "d"};
+    using view = decltype(tuplet::zip(a, b));
+
+    STATIC_REQUIRE(!view::contiguous);
+    STATIC_REQUIRE(std::is_same_v<
+                   std::iterator_traits<view::iterator>::reference,
+                   tuple<int&, std::string&>>);
+
+    size_t count = 0;
+    for (auto [x, s] : tuplet::zip(a, b)) {
+        s += std::to_string(x);
+        count++;
+    }
+    REQUIRE(count == 3);
+    REQUIRE(b == std::vector<std::string> {"a1", "b2", "c3", "d"});
+}
+
+TEST_CASE("zip iterators over other ranges are input iterators", "[zip]") {
+    std::list<int> a {1, 2};
+    using view = decltype(tuplet::zip(a, a));
+    STATIC_REQUIRE(std::is_same_v<
+                   std::iterator_traits<view::iterator>::iterator_category,
+                   std::input_iterator_tag>);
+}
+
+TEST_CASE("const zip views can be iterated", "[zip]") {
+    std::vector<int> a {1, 2, 3};
+    std::list<int> l {1, 2, 3};
+    auto const view = tuplet::zip(a, std::vector<int> {4, 5, 6});
+    auto const list_view = tuplet::zip(l, std::list<int> {7, 8});
+
+    // The referenced range stays mutable, and the owned one is const
+    STATIC_REQUIRE(std::is_same_v<
+                   decltype(*view.begin()),
+                   tuple<int&, int const&>>);
+    STATIC_REQUIRE(std::is_same_v<
+                   decltype(*list_view.begin()),
+                   tuple<int&, int const&>>);
+
+    int sum = 0;
+    for (auto [x, y] : view) {
+        sum += x * y;
+        x = 0;
+    }
+    REQUIRE(sum == 4 + 10 + 18);
+    REQUIRE(a == std::vector<int> {0, 0, 0});
+    REQUIRE(view.size() == 3);
+
+    size_t count = 0;
+    for (auto [x, y] : list_view) {
+        count += size_t(x + y);
+    }
+    REQUIRE(count == 8 + 10);
+}
+
+TEST_CASE("zip takes ownership of temporary ranges", "[zip]") {
+    std::vector<int> a {1, 2, 3};
+    using view = decltype(tuplet::zip(a, std::vector<int> {4, 5, 6}));
+    STATIC_REQUIRE(std::is_same_v<
+                   view,
+                   tuplet::zip_view<std::vector<int>&, std::vector<int>>>);
+
+    int sum = 0;
+    for (auto [x, y] : tuplet::zip(a, std::vector<int> {4, 5, 6})) {
+        sum += x * y;
+    }
+    REQUIRE(sum == 4 + 10 + 18);
+}
+
+TEST_CASE("zip_for_each calls the function with each set of elements", "[zip]") {
+    std::vector<float> x {1, 2, 3, 4};
+    std::vector<float> y {10, 20, 30};
+    tuplet::zip_for_each([](float& yi, float xi) { yi += 2 * xi; }, y, x);
+    REQUIRE(y == std::vector<float> {12, 24, 36});
+
+    std::list<int> a {1, 2, 3};
+    std::string b = "ab";
+    std::string out;
+    tuplet::zip_for_each(
+        [&](int i, char c) { out += std::string(size_t(i), c); },
+        a,
+        b);
+    REQUIRE(out == "abb");
+}
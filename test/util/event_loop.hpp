@@ -0,0 +1,124 @@
+#pragma once
+#if __cpp_impl_coroutine
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+// Minimal coroutine support for testing awaitables: a lazily started task<T>,
+// and a single-threaded event loop that tasks can reschedule themselves on.
+namespace loop {
+    template <class T>
+    class task {
+       public:
+        struct promise_type {
+            std::optional<T> result;
+            std::exception_ptr error;
+            std::coroutine_handle<> continuation = std::noop_coroutine();
+
+            struct final_awaiter {
+                bool await_ready() noexcept { return false; }
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> self) noexcept {
+                    return self.promise().continuation;
+                }
+                void await_resume() noexcept {}
+            };
+
+            task get_return_object() noexcept {
+                return task(
+                    std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            final_awaiter final_suspend() noexcept { return {}; }
+            template <class U>
+            void return_value(U&& value) {
+                result.emplace(static_cast<U&&>(value));
+            }
+            void unhandled_exception() noexcept {
+                error = std::current_exception();
+            }
+        };
+
+        task(task&& other) noexcept
+          : handle(std::exchange(other.handle, nullptr)) {}
+        ~task() {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        bool done() const noexcept { return handle.done(); }
+
+        T get() {
+            if (handle.promise().error) {
+                std::rethrow_exception(handle.promise().error);
+            }
+            return std::move(*handle.promise().result);
+        }
+
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) {
+            handle.promise().continuation = caller;
+            return handle;
+        }
+        T await_resume() { return get(); }
+
+        void start() { handle.resume(); }
+
+       private:
+        explicit task(std::coroutine_handle<promise_type> handle)
+          : handle(handle) {}
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    class event_loop {
+       public:
+        /// Awaiting the result suspends the current coroutine, and resumes
+        /// it from run() after everything already scheduled has run
+        auto yield() {
+            struct awaiter {
+                event_loop& loop;
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(std::coroutine_handle<> caller) {
+                    loop.ready.push_back(caller);
+                }
+                void await_resume() const noexcept {}
+            };
+            return awaiter {*this};
+        }
+
+        /// Suspends the current coroutine, and resumes it after the given
+        /// number of turns of the loop
+        task<int> sleep(int turns) {
+            for (int i = 0; i < turns; i++) {
+                co_await yield();
+            }
+            co_return turns;
+        }
+
+        template <class T>
+        T run(task<T> t) {
+            t.start();
+            while (!ready.empty()) {
+                std::coroutine_handle<> next = ready.front();
+                ready.pop_front();
+                next.resume();
+                turns++;
+            }
+            if (!t.done()) {
+                throw std::logic_error("Task is waiting on nothing");
+            }
+            return t.get();
+        }
+
+        int turns = 0;
+
+       private:
+        std::deque<std::coroutine_handle<>> ready;
+    };
+} // namespace loop
+#endif